@@ -6,29 +6,51 @@ in vec3 FragPos;
 in vec3 Normal;
 in vec2 TexCoord;
 
-uniform vec3 lightDir;
-uniform vec3 lightColor;
-uniform vec3 viewPos;
+struct LightData
+{
+    vec4 direction;
+    vec4 color;
+};
+
+// 모든 셰이더가 공유하는 프레임 상수 (FrameConstants와 같은 배치)
+layout (std140) uniform FrameConstants
+{
+    mat4      view;
+    mat4      projection;
+    mat4      viewProjection;
+    mat4      screenProjection; // 화면 좌표계의 직교 투영
+    vec4      cameraPosition;
+    vec4      time;             // x: 경과 시간, y: 델타 타임, z: 배율이 적용되지 않은 델타 타임
+    ivec4     lightCount;       // x: 조명 개수
+    LightData lights[4];
+};
+
 uniform sampler2D outTexture;
 
 void main()
 {
     float ambientStrength = 0.3;
-    vec3 ambient = ambientStrength * lightColor;
+    float specularStrength = 0.5;
 
     vec3 norm = normalize(Normal);
+    vec3 viewDir = normalize(cameraPosition.xyz - FragPos);
 
-    vec3 lightDirection = normalize(-lightDir); 
-    float diff = max(dot(norm, lightDirection), 0.0);
-    vec3 diffuse = diff * lightColor;
+    vec3 result = vec3(0.0);
+    for (int i = 0; i < lightCount.x; ++i)
+    {
+        vec3 lightColor = lights[i].color.rgb;
+        vec3 ambient = ambientStrength * lightColor;
 
-    float specularStrength = 0.5;
-    vec3 viewDir = normalize(viewPos - FragPos);
-    vec3 reflectDir = reflect(-lightDirection, norm);  
+        vec3 lightDirection = normalize(-lights[i].direction.xyz);
+        float diff = max(dot(norm, lightDirection), 0.0);
+        vec3 diffuse = diff * lightColor;
+
+        vec3 reflectDir = reflect(-lightDirection, norm);
+        float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
+        vec3 specular = specularStrength * spec * lightColor;
 
-    float spec = pow(max(dot(viewDir, reflectDir), 0.0), 32.0);
-    vec3 specular = specularStrength * spec * lightColor;  
+        result += ambient + diffuse + specular;
+    }
 
-    vec3 result = (ambient + diffuse + specular);
     FragColor = texture(outTexture, TexCoord) * vec4(result, 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,45 @@
+#version 330 core
+
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec3 aNormal; // 로컬 공간의 법선 벡터
+layout (location = 2) in vec2 aTexCoord;
+
+uniform mat4 model;
+
+// 양자화된 위치(Mesh::VertexFormat::Quantized)를 복원하는 값. 다른 형식에서는 기본값 그대로입니다.
+uniform vec3 positionScale  = vec3(1.0);
+uniform vec3 positionOffset = vec3(0.0);
+
+struct LightData
+{
+    vec4 direction;
+    vec4 color;
+};
+
+// 모든 셰이더가 공유하는 프레임 상수 (FrameConstants와 같은 배치)
+layout (std140) uniform FrameConstants
+{
+    mat4      view;
+    mat4      projection;
+    mat4      viewProjection;
+    mat4      screenProjection; // 화면 좌표계의 직교 투영
+    vec4      cameraPosition;
+    vec4      time;             // x: 경과 시간, y: 델타 타임, z: 배율이 적용되지 않은 델타 타임
+    ivec4     lightCount;       // x: 조명 개수
+    LightData lights[4];
+};
+
+out vec3 FragPos;
+out vec3 Normal;
+out vec2 TexCoord;
+
+void main()
+{
+    FragPos = vec3(model * vec4(aPos * positionScale + positionOffset, 1.0));
+
+    Normal = mat3(model) * aNormal; 
+    
+    TexCoord = aTexCoord;
+
+    gl_Position = viewProjection * vec4(FragPos, 1.0);
+}
\ No newline at end of file
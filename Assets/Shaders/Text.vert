@@ -3,10 +3,27 @@ layout (location = 0) in vec4 vertex; // <vec2 pos, vec2 tex>
 
 out vec2 TexCoords;
 
-uniform mat4 projection;
+struct LightData
+{
+    vec4 direction;
+    vec4 color;
+};
+
+// 모든 셰이더가 공유하는 프레임 상수 (FrameConstants와 같은 배치)
+layout (std140) uniform FrameConstants
+{
+    mat4      view;
+    mat4      projection;
+    mat4      viewProjection;
+    mat4      screenProjection; // 화면 좌표계의 직교 투영
+    vec4      cameraPosition;
+    vec4      time;             // x: 경과 시간, y: 델타 타임, z: 배율이 적용되지 않은 델타 타임
+    ivec4     lightCount;       // x: 조명 개수
+    LightData lights[4];
+};
 
 void main()
 {
-    gl_Position = projection * vec4(vertex.xy, 0.0, 1.0);
+    gl_Position = screenProjection * vec4(vertex.xy, 0.0, 1.0);
     TexCoords = vertex.zw;
 }
\ No newline at end of file
@@ -2,7 +2,11 @@
 
 #include "Audio.h"
 #include "Debug.h"
+#include "Graphics.h"
 #include "Input.h"
+#include "Jobs.h"
+#include "Rendering.h"
+#include "Resources.h"
 #include "Scenes.h"
 #include "Time.h"
 
@@ -12,6 +16,14 @@ bool Application::Initialize(const Specification& specification_) noexcept
 
     Logger::Initialize();
 
+#if defined(GLFW_PLATFORM_NULL)
+    // 헤드리스 모드에서는 디스플레이 서버가 없어도 초기화되도록 GLFW의 null 플랫폼을 사용합니다.
+    if (IsHeadless() && glfwPlatformSupported(GLFW_PLATFORM_NULL))
+    {
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+    }
+#endif
+
     if (!glfwInit())
     {
         Logger::Critical("Failed to initialize GLFW.");
@@ -68,6 +80,12 @@ bool Application::Initialize(const Specification& specification_) noexcept
 
             break;
         }
+        case Application::ScreenMode::Headless:
+        {
+            window = CreateHeadlessWindow();
+
+            break;
+        }
         default:
         {
             break;
@@ -89,10 +107,12 @@ bool Application::Initialize(const Specification& specification_) noexcept
         return false;
     }
 
-    glEnable(GL_DEPTH_TEST);
+    GraphicsState::Initialize();
 
-    glEnable(GL_CULL_FACE);
-    glCullFace(GL_BACK);
+    if (IsHeadless() && !CreateHeadlessFramebuffer())
+    {
+        return false;
+    }
 
 #if defined(DEBUG) || defined(_DEBUG)
     glEnable(GL_DEBUG_OUTPUT);
@@ -106,13 +126,26 @@ bool Application::Initialize(const Specification& specification_) noexcept
     InputManager::Initialize(window);
     TimeManager::Initialize();
     SceneManager::Initialize();
-    AudioSystem::Initialize();
+
+    // 헤드리스 모드는 소리를 낼 필요가 없고 오디오 장치가 없는 환경에서도 실행되어야 하므로 오디오 장치를 열지 않습니다.
+    if (!IsHeadless())
+    {
+        AudioSystem::Initialize();
+    }
+
+    JobSystem::Initialize(specification.threadCount);
+    FrameConstants::Initialize();
+    StreamBuffer::Initialize();
+    GpuProfiler::Initialize();
 
     return true;
 }
 
 int Application::Run() noexcept
 {
+    const auto startTime  = std::chrono::steady_clock::now();
+    int        frameCount = 0;
+
     while (!glfwWindowShouldClose(const_cast<GLFWwindow*>(window)))
     {
         InputManager::Update();
@@ -122,8 +155,34 @@ int Application::Run() noexcept
 
         Update();
         Render();
+
+        // 프레임이 끝난 뒤 이번 프레임에 파괴된 오브젝트와 컴포넌트들을 한꺼번에 해제합니다.
+        if (Scene* const currentScene = SceneManager::GetActiveScene())
+        {
+            currentScene->ProcessDestroyQueue();
+        }
+
+        if (++frameCount == specification.frameLimit)
+        {
+            Quit();
+        }
     }
 
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    Logger::Info("Ran {} frames in {:.2f} s ({:.3f} ms per frame).",
+                 frameCount,
+                 seconds,
+                 frameCount > 0 ? seconds * 1000.0 / frameCount : 0.0);
+
+    // 정적 풀들이 해제되기 전에 씬의 오브젝트들을 먼저 반환합니다.
+    SceneManager::UnloadScene();
+    JobSystem::Shutdown();
+    GpuProfiler::Dump();
+    GpuProfiler::Release();
+    StreamBuffer::Release();
+    FrameConstants::Release();
+    ReleaseHeadlessFramebuffer();
+
     return 0;
 }
 
@@ -178,6 +237,14 @@ void Application::Update() noexcept
 
 void Application::Render() noexcept
 {
+    Mesh::ResetStatistics();
+    RenderQueue::ResetStatistics();
+    Shader::ResetStatistics();
+    GraphicsState::ResetStatistics();
+    FrameConstants::BeginFrame();
+    StreamBuffer::BeginFrame();
+    GpuProfiler::BeginFrame();
+
     glClearColor(clearColor.r, clearColor.g, clearColor.b, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
@@ -187,14 +254,109 @@ void Application::Render() noexcept
         return;
     }
 
-    glEnable(GL_DEPTH_TEST);
-    currentScene->Render();
+    GraphicsState::SetDepthTest(true);
+    {
+        GpuProfileScope scope("Scene");
+        currentScene->Render();
+    }
 
-    glDisable(GL_DEPTH_TEST);
-    currentScene->RenderUI();
-    SceneManager::Render();
+    GraphicsState::SetDepthTest(false);
+    {
+        GpuProfileScope scope("UI");
+        currentScene->RenderUI();
+    }
+    {
+        GpuProfileScope scope("Fade");
+        SceneManager::Render();
+    }
+
+    StreamBuffer::EndFrame();
 
-    glfwSwapBuffers(const_cast<GLFWwindow*>(window));
+    // 헤드리스 모드는 화면에 표시할 버퍼가 없으므로 명령만 제출합니다.
+    if (IsHeadless())
+    {
+        glFlush();
+    }
+    else
+    {
+        glfwSwapBuffers(const_cast<GLFWwindow*>(window));
+    }
+}
+
+GLFWwindow* Application::CreateHeadlessWindow() noexcept
+{
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    glfwWindowHint(GLFW_RESIZABLE, GLFW_FALSE);
+
+    // Mesa 빌드에 따라 OSMesa나 EGL 중 하나만 있을 수 있으므로 차례로 시도합니다.
+    constexpr std::array<std::pair<int, const char*>, 3> contextApis = {{
+            {GLFW_OSMESA_CONTEXT_API, "OSMesa"},
+            {GLFW_EGL_CONTEXT_API, "EGL"},
+            {GLFW_NATIVE_CONTEXT_API, "native"},
+    }};
+
+    for (const auto& [api, apiName] : contextApis)
+    {
+        glfwWindowHint(GLFW_CONTEXT_CREATION_API, api);
+
+        GLFWwindow* const headlessWindow = glfwCreateWindow(
+                specification.width, specification.height, specification.name.c_str(), nullptr, nullptr);
+        if (headlessWindow)
+        {
+            Logger::Info("Headless: created an invisible {} context.", apiName);
+            return headlessWindow;
+        }
+    }
+
+    return nullptr;
+}
+
+bool Application::CreateHeadlessFramebuffer() noexcept
+{
+    glGenRenderbuffers(1, &headlessColorBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, headlessColorBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, specification.width, specification.height);
+
+    glGenRenderbuffers(1, &headlessDepthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, headlessDepthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, specification.width, specification.height);
+
+    // 프레임워크는 다른 프레임버퍼를 바인딩하지 않으므로, 한 번 바인딩해 두면 모든 패스가 이 프레임버퍼에 그립니다.
+    glGenFramebuffers(1, &headlessFramebuffer);
+    glBindFramebuffer(GL_FRAMEBUFFER, headlessFramebuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, headlessColorBuffer);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, headlessDepthBuffer);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        Logger::Critical("Headless: offscreen framebuffer is incomplete.");
+        return false;
+    }
+
+    Logger::Info("Headless: rendering to a {}x{} offscreen framebuffer.", specification.width, specification.height);
+    return true;
+}
+
+void Application::ReleaseHeadlessFramebuffer() noexcept
+{
+    if (headlessFramebuffer)
+    {
+        glBindFramebuffer(GL_FRAMEBUFFER, 0);
+        glDeleteFramebuffers(1, &headlessFramebuffer);
+        headlessFramebuffer = 0;
+    }
+
+    if (headlessColorBuffer)
+    {
+        glDeleteRenderbuffers(1, &headlessColorBuffer);
+        headlessColorBuffer = 0;
+    }
+
+    if (headlessDepthBuffer)
+    {
+        glDeleteRenderbuffers(1, &headlessDepthBuffer);
+        headlessDepthBuffer = 0;
+    }
 }
 
 #if defined(DEBUG) || defined(_DEBUG)
@@ -240,4 +402,8 @@ Application::Specification Application::specification;
 
 GLFWwindow* Application::window = nullptr;
 
-glm::fvec3 Application::clearColor = glm::fvec3(0.1f, 0.1f, 0.1f);
\ No newline at end of file
+glm::fvec3 Application::clearColor = glm::fvec3(0.1f, 0.1f, 0.1f);
+
+unsigned int Application::headlessFramebuffer = 0;
+unsigned int Application::headlessColorBuffer = 0;
+unsigned int Application::headlessDepthBuffer = 0;
\ No newline at end of file
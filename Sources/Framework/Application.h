@@ -32,7 +32,12 @@ class Application final
         /**
          * @brief 테두리 없는 창 모드.
          */
-        Borderless
+        Borderless,
+
+        /**
+         * @brief 헤드리스 모드. 디스플레이 없이 보이지 않는 컨텍스트를 만들고 오프스크린 프레임버퍼에 렌더링합니다.
+         */
+        Headless
     };
 
     struct Specification final
@@ -61,6 +66,16 @@ class Application final
          * @brief 수직 동기화 활성화 여부.
          */
         bool sholudVSync;
+
+        /**
+         * @brief 실행할 프레임 수. 이만큼 렌더링한 뒤 종료하며, 0이라면 창이 닫힐 때까지 실행합니다.
+         */
+        int frameLimit = 0;
+
+        /**
+         * @brief 작업 시스템이 사용할 메인 스레드를 포함한 스레드 수. 0이라면 하드웨어 스레드 개수를 사용합니다.
+         */
+        std::size_t threadCount = 0;
     };
 
     /**
@@ -95,6 +110,17 @@ class Application final
         return window;
     }
 
+    /**
+     * @brief 헤드리스 모드로 실행 중인지 여부를 반환합니다.
+     *
+     * @return bool 헤드리스 모드 여부.
+     */
+    [[nodiscard]]
+    static inline bool IsHeadless() noexcept
+    {
+        return specification.screenMode == ScreenMode::Headless;
+    }
+
     /**
      * @brief 애플리케이션 이름을 반환합니다.
      *
@@ -160,6 +186,25 @@ class Application final
      */
     static void Render() noexcept;
 
+    /**
+     * @brief 디스플레이 없이 만들 수 있는 컨텍스트(OSMesa, EGL 순)로 보이지 않는 창을 생성합니다.
+     *
+     * @return GLFWwindow* 생성한 창. 실패했다면 nullptr.
+     */
+    static GLFWwindow* CreateHeadlessWindow() noexcept;
+
+    /**
+     * @brief 헤드리스 모드의 렌더 타깃인 프레임버퍼를 생성하고 바인딩합니다.
+     *
+     * @return bool 프레임버퍼 생성 성공 여부.
+     */
+    static bool CreateHeadlessFramebuffer() noexcept;
+
+    /**
+     * @brief 헤드리스 모드의 프레임버퍼를 해제합니다.
+     */
+    static void ReleaseHeadlessFramebuffer() noexcept;
+
 #if defined(DEBUG) || defined(_DEBUG)
     /**
      * @brief 디버그 콜백 함수.
@@ -187,4 +232,19 @@ class Application final
      * @brief 클리어 컬러.
      */
     static glm::vec3 clearColor;
+
+    /**
+     * @brief 헤드리스 모드의 프레임버퍼.
+     */
+    static unsigned int headlessFramebuffer;
+
+    /**
+     * @brief 헤드리스 모드 프레임버퍼의 색상 렌더버퍼.
+     */
+    static unsigned int headlessColorBuffer;
+
+    /**
+     * @brief 헤드리스 모드 프레임버퍼의 깊이/스텐실 렌더버퍼.
+     */
+    static unsigned int headlessDepthBuffer;
 };
\ No newline at end of file
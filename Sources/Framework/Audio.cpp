@@ -16,23 +16,25 @@ namespace
     ALCcontext* context = nullptr;
 }
 
-void AudioSystem::Initialize()
+bool AudioSystem::Initialize() noexcept
 {
     device = alcOpenDevice(nullptr);
     if (!device)
     {
-        Logger::Error("OpenAL: Failed to open default device.");
-        throw std::runtime_error("OpenAL: Failed to open default device.");
+        Logger::Warn("OpenAL: Failed to open default device. Audio is disabled.");
+        return false;
     }
 
     context = alcCreateContext(device, nullptr);
     if (!context || !alcMakeContextCurrent(context))
     {
-        Logger::Error("OpenAL: Failed to create/make current context.");
-        throw std::runtime_error("OpenAL: Failed to create/make current context.");
+        Logger::Warn("OpenAL: Failed to create/make current context. Audio is disabled.");
+        Quit();
+        return false;
     }
 
     Logger::Info("Audio System Initialized (OpenAL).");
+    return true;
 }
 
 void AudioSystem::Quit()
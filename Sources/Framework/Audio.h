@@ -11,8 +11,12 @@ namespace AudioSystem
 {
     /**
      * @brief 오디오 시스템을 초기화합니다.
+     *
+     * @details 오디오 장치가 없다면 경고만 남깁니다. 현재 컨텍스트가 없으면 OpenAL 호출이 무시되므로 소리 없이 계속 실행됩니다.
+     *
+     * @return bool 오디오 장치를 열었는지 여부
      */
-    void Initialize();
+    bool Initialize() noexcept;
 
     /**
      * @brief 오디오 시스템을 종료합니다.
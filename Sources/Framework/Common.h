@@ -1,17 +1,26 @@
 #pragma once
 
 // Standard
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bitset>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <format>
 #include <fstream>
+#include <functional>
+#include <limits>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <queue>
 #include <set>
@@ -20,6 +29,8 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 #include <typeinfo>
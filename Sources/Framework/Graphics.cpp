@@ -0,0 +1,714 @@
+#include "Graphics.h"
+
+#include <cmath>
+#include <numeric>
+
+#include "Debug.h"
+
+void GraphicsState::UseProgram(const unsigned int program_) noexcept
+{
+    if (Track(program != program_))
+    {
+        glUseProgram(program_);
+        program = program_;
+    }
+}
+
+void GraphicsState::BindTexture(const unsigned int unit_, const unsigned int target_, const unsigned int texture_) noexcept
+{
+    TextureBinding& binding = textures[unit_];
+    if (!Track(binding.target != target_ || binding.texture != texture_))
+    {
+        return;
+    }
+
+    if (activeTextureUnit != unit_)
+    {
+        glActiveTexture(GL_TEXTURE0 + unit_);
+        activeTextureUnit = unit_;
+    }
+
+    glBindTexture(target_, texture_);
+    binding = { target_, texture_ };
+}
+
+void GraphicsState::BindVertexArray(const unsigned int vertexArray_) noexcept
+{
+    if (Track(vertexArray != vertexArray_))
+    {
+        glBindVertexArray(vertexArray_);
+        vertexArray = vertexArray_;
+
+        // 요소 배열 버퍼는 정점 배열마다 따로 저장되므로, 새 정점 배열에 무엇이 연결되어 있는지 알 수 없습니다.
+        buffers[ElementArrayBuffer] = std::numeric_limits<unsigned int>::max();
+    }
+}
+
+void GraphicsState::BindBuffer(const unsigned int target_, const unsigned int buffer_) noexcept
+{
+    const BufferSlot slot = GetBufferSlot(target_);
+    if (slot == BufferSlotCount)
+    {
+        ++statistics.issuedCount;
+        glBindBuffer(target_, buffer_);
+        return;
+    }
+
+    if (Track(buffers[slot] != buffer_))
+    {
+        glBindBuffer(target_, buffer_);
+        buffers[slot] = buffer_;
+    }
+}
+
+void GraphicsState::SetBlending(const bool isEnabled_) noexcept
+{
+    SetCapability(GL_BLEND, isBlendingEnabled, isEnabled_);
+}
+
+void GraphicsState::SetBlendFunction(const unsigned int source_, const unsigned int destination_) noexcept
+{
+    if (Track(blendSource != source_ || blendDestination != destination_))
+    {
+        glBlendFunc(source_, destination_);
+        blendSource      = source_;
+        blendDestination = destination_;
+    }
+}
+
+void GraphicsState::SetDepthTest(const bool isEnabled_) noexcept
+{
+    SetCapability(GL_DEPTH_TEST, isDepthTestEnabled, isEnabled_);
+}
+
+void GraphicsState::SetDepthWrite(const bool isEnabled_) noexcept
+{
+    if (Track(isDepthWriteEnabled != isEnabled_))
+    {
+        glDepthMask(isEnabled_ ? GL_TRUE : GL_FALSE);
+        isDepthWriteEnabled = isEnabled_;
+    }
+}
+
+void GraphicsState::SetFaceCulling(const bool isEnabled_) noexcept
+{
+    SetCapability(GL_CULL_FACE, isFaceCullingEnabled, isEnabled_);
+}
+
+void GraphicsState::SetScissorTest(const bool isEnabled_) noexcept
+{
+    SetCapability(GL_SCISSOR_TEST, isScissorTestEnabled, isEnabled_);
+}
+
+void GraphicsState::DeleteProgram(unsigned int& program_) noexcept
+{
+    if (program_ == 0)
+    {
+        return;
+    }
+
+    if (program == program_)
+    {
+        program = 0;
+    }
+
+    glDeleteProgram(program_);
+    program_ = 0;
+}
+
+void GraphicsState::DeleteTexture(unsigned int& texture_) noexcept
+{
+    if (texture_ == 0)
+    {
+        return;
+    }
+
+    // 삭제된 텍스처가 바인딩된 유닛은 GL이 0으로 되돌립니다.
+    for (TextureBinding& binding : textures)
+    {
+        if (binding.texture == texture_)
+        {
+            binding.texture = 0;
+        }
+    }
+
+    glDeleteTextures(1, &texture_);
+    texture_ = 0;
+}
+
+void GraphicsState::DeleteVertexArray(unsigned int& vertexArray_) noexcept
+{
+    if (vertexArray_ == 0)
+    {
+        return;
+    }
+
+    if (vertexArray == vertexArray_)
+    {
+        vertexArray = 0;
+    }
+
+    glDeleteVertexArrays(1, &vertexArray_);
+    vertexArray_ = 0;
+}
+
+void GraphicsState::DeleteBuffer(unsigned int& buffer_) noexcept
+{
+    if (buffer_ == 0)
+    {
+        return;
+    }
+
+    for (unsigned int& buffer : buffers)
+    {
+        if (buffer == buffer_)
+        {
+            buffer = 0;
+        }
+    }
+
+    glDeleteBuffers(1, &buffer_);
+    buffer_ = 0;
+}
+
+void GraphicsState::Initialize() noexcept
+{
+    // 캐시와 실제 상태가 확실히 같도록 초기 상태를 직접 설정합니다.
+    program           = 0;
+    activeTextureUnit = 0;
+    vertexArray       = 0;
+    textures.fill(TextureBinding());
+    buffers.fill(0);
+
+    glUseProgram(0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+    isBlendingEnabled = false;
+    glDisable(GL_BLEND);
+
+    blendSource      = GL_SRC_ALPHA;
+    blendDestination = GL_ONE_MINUS_SRC_ALPHA;
+    glBlendFunc(blendSource, blendDestination);
+
+    isDepthTestEnabled = true;
+    glEnable(GL_DEPTH_TEST);
+
+    isDepthWriteEnabled = true;
+    glDepthMask(GL_TRUE);
+
+    isFaceCullingEnabled = true;
+    glEnable(GL_CULL_FACE);
+    glCullFace(GL_BACK);
+
+    isScissorTestEnabled = false;
+    glDisable(GL_SCISSOR_TEST);
+}
+
+GraphicsState::BufferSlot GraphicsState::GetBufferSlot(const unsigned int target_) noexcept
+{
+    switch (target_)
+    {
+        case GL_ARRAY_BUFFER:
+        {
+            return ArrayBuffer;
+        }
+        case GL_ELEMENT_ARRAY_BUFFER:
+        {
+            return ElementArrayBuffer;
+        }
+        case GL_UNIFORM_BUFFER:
+        {
+            return UniformBuffer;
+        }
+        default:
+        {
+            return BufferSlotCount;
+        }
+    }
+}
+
+void GraphicsState::SetCapability(const unsigned int capability_, bool& current_, const bool isEnabled_) noexcept
+{
+    if (Track(current_ != isEnabled_))
+    {
+        if (isEnabled_)
+        {
+            glEnable(capability_);
+        }
+        else
+        {
+            glDisable(capability_);
+        }
+
+        current_ = isEnabled_;
+    }
+}
+
+unsigned int                                                              GraphicsState::program              = 0;
+unsigned int                                                              GraphicsState::activeTextureUnit    = 0;
+std::array<GraphicsState::TextureBinding, GraphicsState::MaxTextureUnits> GraphicsState::textures;
+unsigned int                                                              GraphicsState::vertexArray          = 0;
+std::array<unsigned int, GraphicsState::BufferSlotCount>                  GraphicsState::buffers              = {};
+bool                                                                      GraphicsState::isBlendingEnabled    = false;
+unsigned int                                                              GraphicsState::blendSource          = 0;
+unsigned int                                                              GraphicsState::blendDestination     = 0;
+bool                                                                      GraphicsState::isDepthTestEnabled   = false;
+bool                                                                      GraphicsState::isDepthWriteEnabled  = true;
+bool                                                                      GraphicsState::isFaceCullingEnabled = false;
+bool                                                                      GraphicsState::isScissorTestEnabled = false;
+GraphicsStateStatistics                                                   GraphicsState::statistics;
+
+void StreamBuffer::Initialize() noexcept
+{
+    glGenBuffers(1, &buffer);
+    GraphicsState::BindBuffer(GL_ARRAY_BUFFER, buffer);
+
+    if (GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage)
+    {
+        constexpr GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+        glBufferStorage(GL_ARRAY_BUFFER, FrameCount * FrameCapacity, nullptr, flags);
+        mappedData = static_cast<std::uint8_t*>(glMapBufferRange(GL_ARRAY_BUFFER, 0, FrameCount * FrameCapacity, flags));
+    }
+
+    if (mappedData)
+    {
+        Logger::Info("Stream buffer: persistently mapped, {} frames x {} KiB.", FrameCount, FrameCapacity / 1024);
+    }
+    else
+    {
+        // 불변 저장 공간은 다시 할당할 수 없으므로 고아화 경로를 위해 버퍼를 새로 만듭니다.
+        GraphicsState::DeleteBuffer(buffer);
+        glGenBuffers(1, &buffer);
+        GraphicsState::BindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, FrameCapacity, nullptr, GL_STREAM_DRAW);
+
+        Logger::Warn("Stream buffer: persistent mapping unavailable, falling back to orphaning ({} KiB).", FrameCapacity / 1024);
+    }
+
+    frameIndex  = 0;
+    regionBegin = 0;
+    head        = 0;
+}
+
+void StreamBuffer::Release() noexcept
+{
+    for (GLsync& fence : fences)
+    {
+        if (fence)
+        {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
+
+    if (mappedData)
+    {
+        GraphicsState::BindBuffer(GL_ARRAY_BUFFER, buffer);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
+        mappedData = nullptr;
+    }
+
+    GraphicsState::DeleteBuffer(buffer);
+}
+
+void StreamBuffer::BeginFrame() noexcept
+{
+    statistics = StreamBufferStatistics();
+
+    if (!mappedData)
+    {
+        // 이전 프레임의 드로우 콜이 읽는 저장 공간은 드라이버에 맡기고 새 저장 공간을 받습니다.
+        GraphicsState::BindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferData(GL_ARRAY_BUFFER, FrameCapacity, nullptr, GL_STREAM_DRAW);
+
+        regionBegin = 0;
+        head        = 0;
+        return;
+    }
+
+    frameIndex  = (frameIndex + 1) % FrameCount;
+    regionBegin = frameIndex * FrameCapacity;
+    head        = regionBegin;
+
+    GLsync& fence = fences[frameIndex];
+    if (!fence)
+    {
+        return;
+    }
+
+    // FrameCount 프레임 전에 추가한 울타리이므로 대부분 이미 신호를 받은 상태입니다.
+    GLenum result = glClientWaitSync(fence, 0, 0);
+    if (result == GL_TIMEOUT_EXPIRED)
+    {
+        ++statistics.stallCount;
+        do
+        {
+            result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1'000'000);
+        } while (result == GL_TIMEOUT_EXPIRED);
+    }
+
+    if (result == GL_WAIT_FAILED)
+    {
+        Logger::Error("Stream buffer: failed to wait for frame region {}.", frameIndex);
+    }
+
+    glDeleteSync(fence);
+    fence = nullptr;
+}
+
+void StreamBuffer::EndFrame() noexcept
+{
+    if (mappedData && head != regionBegin)
+    {
+        fences[frameIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    }
+}
+
+std::size_t StreamBuffer::Write(const void* const data_, const std::size_t size_, const std::size_t alignment_) noexcept
+{
+    if (size_ == 0)
+    {
+        return InvalidOffset;
+    }
+
+    const std::size_t offset = (head + alignment_ - 1) / alignment_ * alignment_;
+    if (offset + size_ > regionBegin + FrameCapacity)
+    {
+        if (statistics.rejectedCount++ == 0)
+        {
+            Logger::Warn("Stream buffer: frame region exhausted, dropping a {} byte write.", size_);
+        }
+        return InvalidOffset;
+    }
+
+    if (mappedData)
+    {
+        std::memcpy(mappedData + offset, data_, size_);
+    }
+    else
+    {
+        GraphicsState::BindBuffer(GL_ARRAY_BUFFER, buffer);
+        glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(size_), data_);
+    }
+
+    head = offset + size_;
+
+    ++statistics.writeCount;
+    statistics.writtenBytes += size_;
+
+    return offset;
+}
+
+unsigned int                                 StreamBuffer::buffer      = 0;
+std::uint8_t*                                StreamBuffer::mappedData  = nullptr;
+std::array<GLsync, StreamBuffer::FrameCount> StreamBuffer::fences      = {};
+std::size_t                                  StreamBuffer::frameIndex  = 0;
+std::size_t                                  StreamBuffer::regionBegin = 0;
+std::size_t                                  StreamBuffer::head        = 0;
+StreamBufferStatistics                       StreamBuffer::statistics;
+
+/**
+ * @brief 정렬된 표본에서 가장 가까운 순위 방식으로 백분위수를 구합니다.
+ *
+ * @param sorted_     오름차순으로 정렬된 표본들
+ * @param percentile_ 0과 1 사이의 백분위
+ *
+ * @return double 백분위수. 표본이 없다면 0
+ */
+static double Percentile(const std::vector<double>& sorted_, const double percentile_)
+{
+    if (sorted_.empty())
+    {
+        return 0.0;
+    }
+
+    const auto rank = static_cast<std::size_t>(std::ceil(percentile_ * static_cast<double>(sorted_.size())));
+    return sorted_[std::clamp<std::size_t>(rank, 1, sorted_.size()) - 1];
+}
+
+void GpuProfiler::BeginScope(const std::string_view name_) noexcept
+{
+    std::vector<Scope>& frameScopes = scopes[frameIndex];
+    if (frameScopes.size() >= MaxScopesPerFrame)
+    {
+        static bool hasWarned = false;
+        if (!hasWarned)
+        {
+            hasWarned = true;
+            Logger::Warn("GPU profiler: more than {} scopes in a frame, ignoring '{}'.", MaxScopesPerFrame, name_);
+        }
+
+        openScopes.push_back(InvalidScope);
+        return;
+    }
+
+    const std::size_t index = frameScopes.size();
+    frameScopes.push_back(Scope{FindOrAddPass(name_), std::chrono::steady_clock::now()});
+    openScopes.push_back(index);
+
+    if (isSupported)
+    {
+        glQueryCounter(queries[frameIndex][index * 2], GL_TIMESTAMP);
+    }
+}
+
+void GpuProfiler::EndScope() noexcept
+{
+    if (openScopes.empty())
+    {
+        Logger::Warn("GPU profiler: EndScope called without a matching BeginScope.");
+        return;
+    }
+
+    const std::size_t index = openScopes.back();
+    openScopes.pop_back();
+
+    if (index == InvalidScope)
+    {
+        return;
+    }
+
+    if (isSupported)
+    {
+        glQueryCounter(queries[frameIndex][index * 2 + 1], GL_TIMESTAMP);
+    }
+
+    Scope& scope          = scopes[frameIndex][index];
+    scope.cpuMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - scope.cpuBegin).count();
+    scope.isClosed        = true;
+}
+
+std::vector<GpuPassStatistics> GpuProfiler::GetPassStatistics() noexcept
+{
+    std::vector<GpuPassStatistics> result;
+    result.reserve(passes.size());
+
+    std::vector<double> gpuSorted;
+    std::vector<double> cpuSorted;
+
+    for (const Pass& pass : passes)
+    {
+        gpuSorted.assign(pass.gpuSamples.begin(), pass.gpuSamples.begin() + pass.sampleCount);
+        cpuSorted.assign(pass.cpuSamples.begin(), pass.cpuSamples.begin() + pass.sampleCount);
+        std::sort(gpuSorted.begin(), gpuSorted.end());
+        std::sort(cpuSorted.begin(), cpuSorted.end());
+
+        GpuPassStatistics statistics;
+        statistics.name        = pass.name;
+        statistics.sampleCount = pass.sampleCount;
+
+        if (pass.sampleCount > 0)
+        {
+            const auto count = static_cast<double>(pass.sampleCount);
+
+            statistics.gpuAverage = std::accumulate(gpuSorted.begin(), gpuSorted.end(), 0.0) / count;
+            statistics.gpuP50     = Percentile(gpuSorted, 0.50);
+            statistics.gpuP95     = Percentile(gpuSorted, 0.95);
+            statistics.gpuP99     = Percentile(gpuSorted, 0.99);
+            statistics.cpuAverage = std::accumulate(cpuSorted.begin(), cpuSorted.end(), 0.0) / count;
+            statistics.cpuP95     = Percentile(cpuSorted, 0.95);
+        }
+
+        result.push_back(std::move(statistics));
+    }
+
+    return result;
+}
+
+void GpuProfiler::Dump() noexcept
+{
+    if (passes.empty())
+    {
+        return;
+    }
+
+    Logger::Info("GPU profiler ({}, {} dropped frames):",
+                 isSupported ? "timestamp queries" : "CPU only",
+                 droppedFrameCount);
+
+    for (const GpuPassStatistics& statistics : GetPassStatistics())
+    {
+        Logger::Info("  {:<12} GPU avg {:.3f} ms, p50 {:.3f}, p95 {:.3f}, p99 {:.3f} | CPU avg {:.3f} ms, p95 {:.3f} ({} samples)",
+                     statistics.name,
+                     statistics.gpuAverage,
+                     statistics.gpuP50,
+                     statistics.gpuP95,
+                     statistics.gpuP99,
+                     statistics.cpuAverage,
+                     statistics.cpuP95,
+                     statistics.sampleCount);
+    }
+}
+
+void GpuProfiler::Initialize() noexcept
+{
+    // 소프트웨어 래스터라이저를 포함해 GL 3.3 이상이면 타임스탬프 쿼리가 코어 기능이지만, 카운터 비트가 0이면 사용할 수 없습니다.
+    GLint counterBits = 0;
+    if (GLAD_GL_VERSION_3_3 || GLAD_GL_ARB_timer_query)
+    {
+        glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &counterBits);
+    }
+
+    isSupported = counterBits > 0;
+
+    if (isSupported)
+    {
+        for (auto& frameQueries : queries)
+        {
+            glGenQueries(static_cast<GLsizei>(frameQueries.size()), frameQueries.data());
+        }
+
+        Logger::Info("GPU profiler: {}-bit timestamp queries, {} frames of latency.", counterBits, FrameCount);
+    }
+    else
+    {
+        Logger::Warn("GPU profiler: timestamp queries unavailable, measuring CPU time only.");
+    }
+
+    for (std::vector<Scope>& frameScopes : scopes)
+    {
+        frameScopes.reserve(MaxScopesPerFrame);
+    }
+
+    frameIndex        = 0;
+    droppedFrameCount = 0;
+}
+
+void GpuProfiler::Release() noexcept
+{
+    if (isSupported)
+    {
+        for (auto& frameQueries : queries)
+        {
+            glDeleteQueries(static_cast<GLsizei>(frameQueries.size()), frameQueries.data());
+            frameQueries.fill(0);
+        }
+    }
+
+    for (std::vector<Scope>& frameScopes : scopes)
+    {
+        frameScopes.clear();
+    }
+
+    openScopes.clear();
+    passes.clear();
+    isSupported = false;
+}
+
+void GpuProfiler::BeginFrame() noexcept
+{
+    if (!openScopes.empty())
+    {
+        Logger::Warn("GPU profiler: {} scopes were left open at the end of the frame.", openScopes.size());
+        openScopes.clear();
+    }
+
+    // 다음 슬롯은 FrameCount - 1 프레임 전에 기록되었으므로, 대부분 결과가 이미 준비되어 있습니다.
+    frameIndex = (frameIndex + 1) % FrameCount;
+    Resolve(frameIndex);
+}
+
+void GpuProfiler::Resolve(const std::size_t frame_) noexcept
+{
+    std::vector<Scope>& frameScopes = scopes[frame_];
+    if (frameScopes.empty())
+    {
+        return;
+    }
+
+    const auto& frameQueries = queries[frame_];
+
+    if (isSupported)
+    {
+        for (std::size_t i = 0; i < frameScopes.size() * 2; ++i)
+        {
+            if (!frameScopes[i / 2].isClosed)
+            {
+                continue;
+            }
+
+            GLint isAvailable = GL_FALSE;
+            glGetQueryObjectiv(frameQueries[i], GL_QUERY_RESULT_AVAILABLE, &isAvailable);
+            if (!isAvailable)
+            {
+                // 결과를 기다리면 GPU와 동기화되므로, 이 프레임의 표본은 버립니다.
+                ++droppedFrameCount;
+                frameScopes.clear();
+                return;
+            }
+        }
+    }
+
+    // 같은 패스를 한 프레임에 여러 번 측정했다면 합쳐서 하나의 표본으로 기록합니다.
+    std::vector<double> gpuTotals(passes.size(), 0.0);
+    std::vector<double> cpuTotals(passes.size(), 0.0);
+    std::vector<bool>   isMeasured(passes.size(), false);
+
+    for (std::size_t i = 0; i < frameScopes.size(); ++i)
+    {
+        const Scope& scope = frameScopes[i];
+        if (!scope.isClosed)
+        {
+            continue;
+        }
+
+        if (isSupported)
+        {
+            GLuint64 begin = 0;
+            GLuint64 end   = 0;
+            glGetQueryObjectui64v(frameQueries[i * 2], GL_QUERY_RESULT, &begin);
+            glGetQueryObjectui64v(frameQueries[i * 2 + 1], GL_QUERY_RESULT, &end);
+
+            if (end > begin)
+            {
+                gpuTotals[scope.pass] += static_cast<double>(end - begin) / 1'000'000.0;
+            }
+        }
+
+        cpuTotals[scope.pass] += scope.cpuMilliseconds;
+        isMeasured[scope.pass] = true;
+    }
+
+    for (std::size_t i = 0; i < passes.size(); ++i)
+    {
+        if (!isMeasured[i])
+        {
+            continue;
+        }
+
+        Pass& pass                       = passes[i];
+        pass.gpuSamples[pass.nextSample] = gpuTotals[i];
+        pass.cpuSamples[pass.nextSample] = cpuTotals[i];
+        pass.nextSample                  = (pass.nextSample + 1) % HistoryLength;
+        pass.sampleCount                 = std::min(pass.sampleCount + 1, HistoryLength);
+    }
+
+    frameScopes.clear();
+}
+
+std::size_t GpuProfiler::FindOrAddPass(const std::string_view name_) noexcept
+{
+    // 패스는 프레임당 몇 개뿐이므로 선형 탐색으로 충분합니다.
+    for (std::size_t i = 0; i < passes.size(); ++i)
+    {
+        if (passes[i].name == name_)
+        {
+            return i;
+        }
+    }
+
+    passes.push_back(Pass{std::string(name_)});
+    return passes.size() - 1;
+}
+
+std::array<std::array<unsigned int, GpuProfiler::MaxScopesPerFrame * 2>, GpuProfiler::FrameCount> GpuProfiler::queries           = {};
+std::array<std::vector<GpuProfiler::Scope>, GpuProfiler::FrameCount>                              GpuProfiler::scopes            = {};
+std::vector<std::size_t>                                                                          GpuProfiler::openScopes;
+std::vector<GpuProfiler::Pass>                                                                    GpuProfiler::passes;
+std::size_t                                                                                       GpuProfiler::frameIndex        = 0;
+std::size_t                                                                                       GpuProfiler::droppedFrameCount = 0;
+bool                                                                                              GpuProfiler::isSupported       = false;
@@ -0,0 +1,738 @@
+#pragma once
+
+#include "Common.h"
+
+/**
+ * @struct GraphicsStateStatistics
+ *
+ * @brief 한 프레임 동안의 GL 상태 변경 통계를 정의합니다.
+ */
+struct GraphicsStateStatistics
+{
+    /**
+     * @brief 실제로 GL에 전달한 상태 변경의 개수.
+     */
+    std::size_t issuedCount = 0;
+
+    /**
+     * @brief 이미 같은 상태라서 생략한 상태 변경의 개수.
+     */
+    std::size_t elidedCount = 0;
+};
+
+/**
+ * @class GraphicsState
+ *
+ * @brief 현재 GL 상태(프로그램, 텍스처 유닛별 텍스처, 정점 배열, 버퍼, 블렌딩, 깊이, 컬링, 가위 테스트)를 기억하여 중복된 GL 호출을 생략합니다.
+ *
+ * @details 캐시가 실제 GL 상태와 어긋나지 않도록, 프레임워크의 모든 렌더링 코드는 상태를 바꿀 때 GL 함수 대신 이 클래스를 사용해야 합니다.
+ *          객체를 삭제할 때도 Delete 함수들을 사용하여, 삭제된 이름이 재사용되었을 때 바인딩이 잘못 생략되지 않도록 합니다.
+ */
+class GraphicsState final
+{
+    friend class Application;
+
+    STATIC_CLASS(GraphicsState)
+
+public:
+    /**
+     * @brief 추적하는 텍스처 유닛의 개수.
+     */
+    static constexpr unsigned int MaxTextureUnits = 16;
+
+    /**
+     * @brief 셰이더 프로그램을 사용합니다.
+     *
+     * @param program_ 사용할 프로그램 ID
+     */
+    static void UseProgram(unsigned int program_) noexcept;
+
+    /**
+     * @brief 지정한 텍스처 유닛에 텍스처를 바인딩합니다.
+     *
+     * @param unit_    텍스처 유닛 (0부터 MaxTextureUnits - 1까지)
+     * @param target_  텍스처 타깃 (GL_TEXTURE_2D 등)
+     * @param texture_ 바인딩할 텍스처 ID
+     */
+    static void BindTexture(unsigned int unit_, unsigned int target_, unsigned int texture_) noexcept;
+
+    /**
+     * @brief 정점 배열 객체를 바인딩합니다. 요소 배열 버퍼는 정점 배열의 상태이므로 함께 잊습니다.
+     *
+     * @param vertexArray_ 바인딩할 정점 배열 객체 ID
+     */
+    static void BindVertexArray(unsigned int vertexArray_) noexcept;
+
+    /**
+     * @brief 버퍼를 바인딩합니다.
+     *
+     * @param target_ 버퍼 타깃 (GL_ARRAY_BUFFER, GL_ELEMENT_ARRAY_BUFFER, GL_UNIFORM_BUFFER)
+     * @param buffer_ 바인딩할 버퍼 ID
+     */
+    static void BindBuffer(unsigned int target_, unsigned int buffer_) noexcept;
+
+    /**
+     * @brief 알파 블렌딩 사용 여부를 설정합니다.
+     *
+     * @param isEnabled_ 사용 여부
+     */
+    static void SetBlending(bool isEnabled_) noexcept;
+
+    /**
+     * @brief 블렌딩 함수를 설정합니다.
+     *
+     * @param source_      원본 계수
+     * @param destination_ 대상 계수
+     */
+    static void SetBlendFunction(unsigned int source_, unsigned int destination_) noexcept;
+
+    /**
+     * @brief 깊이 테스트 사용 여부를 설정합니다.
+     *
+     * @param isEnabled_ 사용 여부
+     */
+    static void SetDepthTest(bool isEnabled_) noexcept;
+
+    /**
+     * @brief 깊이 버퍼 쓰기 여부를 설정합니다.
+     *
+     * @param isEnabled_ 쓰기 여부
+     */
+    static void SetDepthWrite(bool isEnabled_) noexcept;
+
+    /**
+     * @brief 후면 컬링 사용 여부를 설정합니다.
+     *
+     * @param isEnabled_ 사용 여부
+     */
+    static void SetFaceCulling(bool isEnabled_) noexcept;
+
+    /**
+     * @brief 가위 테스트 사용 여부를 설정합니다.
+     *
+     * @param isEnabled_ 사용 여부
+     */
+    static void SetScissorTest(bool isEnabled_) noexcept;
+
+    /**
+     * @brief 셰이더 프로그램을 삭제하고 캐시에서 지웁니다.
+     *
+     * @param program_ 삭제할 프로그램 ID. 0으로 초기화됩니다.
+     */
+    static void DeleteProgram(unsigned int& program_) noexcept;
+
+    /**
+     * @brief 텍스처를 삭제하고 캐시에서 지웁니다.
+     *
+     * @param texture_ 삭제할 텍스처 ID. 0으로 초기화됩니다.
+     */
+    static void DeleteTexture(unsigned int& texture_) noexcept;
+
+    /**
+     * @brief 정점 배열 객체를 삭제하고 캐시에서 지웁니다.
+     *
+     * @param vertexArray_ 삭제할 정점 배열 객체 ID. 0으로 초기화됩니다.
+     */
+    static void DeleteVertexArray(unsigned int& vertexArray_) noexcept;
+
+    /**
+     * @brief 버퍼를 삭제하고 캐시에서 지웁니다.
+     *
+     * @param buffer_ 삭제할 버퍼 ID. 0으로 초기화됩니다.
+     */
+    static void DeleteBuffer(unsigned int& buffer_) noexcept;
+
+    /**
+     * @brief 지난 초기화 이후의 상태 변경 통계를 반환합니다.
+     *
+     * @return const GraphicsStateStatistics& 상태 변경 통계
+     */
+    [[nodiscard]]
+    static inline const GraphicsStateStatistics& GetStatistics() noexcept
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief 상태 변경 통계를 초기화합니다. 매 프레임 시작 시 호출됩니다.
+     */
+    static inline void ResetStatistics() noexcept
+    {
+        statistics = GraphicsStateStatistics();
+    }
+
+private:
+    /**
+     * @brief 버퍼 타깃의 캐시 인덱스를 정의합니다.
+     */
+    enum BufferSlot : std::uint8_t
+    {
+        ArrayBuffer,
+        ElementArrayBuffer,
+        UniformBuffer,
+        BufferSlotCount
+    };
+
+    /**
+     * @struct TextureBinding
+     *
+     * @brief 텍스처 유닛 하나에 바인딩된 텍스처를 정의합니다.
+     */
+    struct TextureBinding
+    {
+        unsigned int target  = 0;
+        unsigned int texture = 0;
+    };
+
+    /**
+     * @brief GL의 기본 상태와 애플리케이션의 초기 상태를 맞추고 캐시를 채웁니다.
+     */
+    static void Initialize() noexcept;
+
+    /**
+     * @brief 버퍼 타깃의 캐시 인덱스를 반환합니다.
+     *
+     * @param target_ 버퍼 타깃
+     *
+     * @return BufferSlot 캐시 인덱스. 추적하지 않는 타깃이라면 BufferSlotCount
+     */
+    [[nodiscard]]
+    static BufferSlot GetBufferSlot(unsigned int target_) noexcept;
+
+    /**
+     * @brief 상태가 바뀌는지 여부를 통계에 기록합니다.
+     *
+     * @param isChanged_ 상태가 바뀌는지 여부
+     *
+     * @return bool isChanged_
+     */
+    static inline bool Track(const bool isChanged_) noexcept
+    {
+        if (isChanged_)
+        {
+            ++statistics.issuedCount;
+        }
+        else
+        {
+            ++statistics.elidedCount;
+        }
+
+        return isChanged_;
+    }
+
+    /**
+     * @brief 지정한 기능을 켜거나 끕니다.
+     *
+     * @param capability_ GL 기능
+     * @param current_    캐시된 현재 상태
+     * @param isEnabled_  설정할 상태
+     */
+    static void SetCapability(unsigned int capability_, bool& current_, bool isEnabled_) noexcept;
+
+    /**
+     * @brief 사용 중인 프로그램.
+     */
+    static unsigned int program;
+
+    /**
+     * @brief 활성화된 텍스처 유닛.
+     */
+    static unsigned int activeTextureUnit;
+
+    /**
+     * @brief 텍스처 유닛별로 바인딩된 텍스처들.
+     */
+    static std::array<TextureBinding, MaxTextureUnits> textures;
+
+    /**
+     * @brief 바인딩된 정점 배열 객체.
+     */
+    static unsigned int vertexArray;
+
+    /**
+     * @brief 타깃별로 바인딩된 버퍼들.
+     */
+    static std::array<unsigned int, BufferSlotCount> buffers;
+
+    /**
+     * @brief 블렌딩 사용 여부.
+     */
+    static bool isBlendingEnabled;
+
+    /**
+     * @brief 블렌딩 원본 계수.
+     */
+    static unsigned int blendSource;
+
+    /**
+     * @brief 블렌딩 대상 계수.
+     */
+    static unsigned int blendDestination;
+
+    /**
+     * @brief 깊이 테스트 사용 여부.
+     */
+    static bool isDepthTestEnabled;
+
+    /**
+     * @brief 깊이 버퍼 쓰기 여부.
+     */
+    static bool isDepthWriteEnabled;
+
+    /**
+     * @brief 후면 컬링 사용 여부.
+     */
+    static bool isFaceCullingEnabled;
+
+    /**
+     * @brief 가위 테스트 사용 여부.
+     */
+    static bool isScissorTestEnabled;
+
+    /**
+     * @brief 상태 변경 통계.
+     */
+    static GraphicsStateStatistics statistics;
+};
+
+/**
+ * @struct StreamBufferStatistics
+ *
+ * @brief 한 프레임 동안의 스트리밍 버퍼 사용 통계를 정의합니다.
+ */
+struct StreamBufferStatistics
+{
+    /**
+     * @brief 기록된 바이트 수.
+     */
+    std::size_t writtenBytes = 0;
+
+    /**
+     * @brief 기록 요청의 개수.
+     */
+    std::size_t writeCount = 0;
+
+    /**
+     * @brief 공간이 부족하여 거절된 기록 요청의 개수.
+     */
+    std::size_t rejectedCount = 0;
+
+    /**
+     * @brief 프레임 시작 시 GPU가 영역 사용을 마치기를 기다려야 했던 횟수.
+     */
+    std::size_t stallCount = 0;
+};
+
+/**
+ * @class StreamBuffer
+ *
+ * @brief 매 프레임 다시 채우는 정점 데이터(텍스트, 동적 UI 등)를 위한 공유 스트리밍 정점 버퍼입니다.
+ *
+ * @details GL 4.4(또는 ARB_buffer_storage)를 지원하면 버퍼를 영구 매핑하고 FrameCount개의 영역으로 나누어,
+ *          각 프레임은 자신의 영역에만 기록하며 울타리(fence)로 GPU가 해당 영역을 다 쓴 뒤에만 다시 사용합니다.
+ *          지원하지 않으면 매 프레임 버퍼를 고아화(orphaning)한 뒤 glBufferSubData로 기록합니다.
+ *          어느 쪽이든 한 프레임 안의 기록은 서로 겹치지 않으므로 드라이버가 동기화할 필요가 없습니다.
+ */
+class StreamBuffer final
+{
+    friend class Application;
+
+    STATIC_CLASS(StreamBuffer)
+
+public:
+    /**
+     * @brief 동시에 사용하는 프레임 영역의 개수.
+     */
+    static constexpr std::size_t FrameCount = 3;
+
+    /**
+     * @brief 한 프레임에 기록할 수 있는 최대 바이트 수.
+     */
+    static constexpr std::size_t FrameCapacity = 1024 * 1024;
+
+    /**
+     * @brief 기록에 실패했음을 나타내는 정점 인덱스.
+     */
+    static constexpr std::uint32_t InvalidVertex = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief 정점들을 이번 프레임 영역에 기록합니다.
+     *
+     * @details 기록 위치는 정점 크기의 배수로 정렬되므로, 반환된 인덱스를 glDrawArrays의 first로 바로 사용할 수 있습니다.
+     *          정점 배열은 GetBuffer()의 버퍼를 오프셋 0부터 읽도록 설정되어 있어야 합니다.
+     *
+     * @param vertices_ 기록할 정점들
+     *
+     * @return std::uint32_t 버퍼 시작 기준 첫 정점의 인덱스. 공간이 부족하다면 InvalidVertex
+     */
+    template <typename T>
+    [[nodiscard]]
+    static std::uint32_t WriteVertices(const std::vector<T>& vertices_) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Stream buffer vertices must be trivially copyable.");
+
+        const std::size_t offset = Write(vertices_.data(), vertices_.size() * sizeof(T), sizeof(T));
+        return offset == InvalidOffset ? InvalidVertex : static_cast<std::uint32_t>(offset / sizeof(T));
+    }
+
+    /**
+     * @brief 스트리밍 버퍼 ID를 반환합니다. 버퍼는 프로그램이 끝날 때까지 바뀌지 않으므로 정점 배열에 한 번만 연결하면 됩니다.
+     *
+     * @return unsigned int 스트리밍 버퍼 ID
+     */
+    [[nodiscard]]
+    static inline unsigned int GetBuffer() noexcept
+    {
+        return buffer;
+    }
+
+    /**
+     * @brief 영구 매핑 경로를 사용하는지 여부를 반환합니다.
+     *
+     * @return bool 영구 매핑 여부. false라면 고아화 경로를 사용합니다.
+     */
+    [[nodiscard]]
+    static inline bool IsPersistent() noexcept
+    {
+        return mappedData != nullptr;
+    }
+
+    /**
+     * @brief 지난 초기화 이후의 사용 통계를 반환합니다.
+     *
+     * @return const StreamBufferStatistics& 사용 통계
+     */
+    [[nodiscard]]
+    static inline const StreamBufferStatistics& GetStatistics() noexcept
+    {
+        return statistics;
+    }
+
+private:
+    /**
+     * @brief 기록에 실패했음을 나타내는 오프셋.
+     */
+    static constexpr std::size_t InvalidOffset = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief 버퍼를 생성하고, 가능하다면 영구 매핑합니다.
+     */
+    static void Initialize() noexcept;
+
+    /**
+     * @brief 울타리와 버퍼를 해제합니다.
+     */
+    static void Release() noexcept;
+
+    /**
+     * @brief 다음 프레임 영역으로 넘어갑니다. 해당 영역을 GPU가 아직 사용 중이라면 끝날 때까지 기다립니다.
+     */
+    static void BeginFrame() noexcept;
+
+    /**
+     * @brief 이번 프레임 영역을 사용하는 명령들 뒤에 울타리를 추가합니다.
+     */
+    static void EndFrame() noexcept;
+
+    /**
+     * @brief 데이터를 이번 프레임 영역에 기록합니다.
+     *
+     * @param data_      기록할 데이터
+     * @param size_      기록할 바이트 수
+     * @param alignment_ 기록 위치의 정렬 단위
+     *
+     * @return std::size_t 버퍼 시작 기준 기록 위치. 공간이 부족하다면 InvalidOffset
+     */
+    static std::size_t Write(const void* data_, std::size_t size_, std::size_t alignment_) noexcept;
+
+    /**
+     * @brief 스트리밍 버퍼 ID.
+     */
+    static unsigned int buffer;
+
+    /**
+     * @brief 영구 매핑된 버퍼의 시작 주소. 고아화 경로라면 nullptr입니다.
+     */
+    static std::uint8_t* mappedData;
+
+    /**
+     * @brief 프레임 영역별 울타리.
+     */
+    static std::array<GLsync, FrameCount> fences;
+
+    /**
+     * @brief 이번 프레임이 사용하는 영역의 인덱스.
+     */
+    static std::size_t frameIndex;
+
+    /**
+     * @brief 이번 프레임 영역의 시작 위치.
+     */
+    static std::size_t regionBegin;
+
+    /**
+     * @brief 이번 프레임 영역에서 다음에 기록할 위치.
+     */
+    static std::size_t head;
+
+    /**
+     * @brief 사용 통계.
+     */
+    static StreamBufferStatistics statistics;
+};
+
+/**
+ * @struct GpuPassStatistics
+ *
+ * @brief 한 렌더 패스의 최근 GPU/CPU 소요 시간 통계를 정의합니다. 시간은 모두 밀리초 단위입니다.
+ */
+struct GpuPassStatistics
+{
+    /**
+     * @brief 패스 이름.
+     */
+    std::string name;
+
+    /**
+     * @brief 통계에 사용된 최근 표본의 개수.
+     */
+    std::size_t sampleCount = 0;
+
+    /**
+     * @brief GPU 소요 시간의 평균.
+     */
+    double gpuAverage = 0.0;
+
+    /**
+     * @brief GPU 소요 시간의 50번째 백분위수.
+     */
+    double gpuP50 = 0.0;
+
+    /**
+     * @brief GPU 소요 시간의 95번째 백분위수.
+     */
+    double gpuP95 = 0.0;
+
+    /**
+     * @brief GPU 소요 시간의 99번째 백분위수.
+     */
+    double gpuP99 = 0.0;
+
+    /**
+     * @brief 같은 구간에서 명령을 기록하는 데 걸린 CPU 시간의 평균.
+     */
+    double cpuAverage = 0.0;
+
+    /**
+     * @brief 같은 구간에서 명령을 기록하는 데 걸린 CPU 시간의 95번째 백분위수.
+     */
+    double cpuP95 = 0.0;
+};
+
+/**
+ * @class GpuProfiler
+ *
+ * @brief 이름 붙은 구간의 GPU 소요 시간을 타임스탬프 쿼리(glQueryCounter)로 측정합니다.
+ *
+ * @details 구간마다 시작과 끝에 타임스탬프 쿼리를 기록하고, 쿼리들은 FrameCount개의 프레임 슬롯을 돌아가며 사용합니다.
+ *          결과는 슬롯을 다시 사용할 차례가 된 프레임 시작 시점에 읽으므로, 그때까지 결과가 준비되지 않은 프레임은 기다리지 않고 버립니다.
+ *          타임스탬프 쿼리를 지원하지 않는 환경(카운터 비트가 0인 드라이버 등)에서는 CPU 시간만 측정합니다.
+ */
+class GpuProfiler final
+{
+    friend class Application;
+
+    STATIC_CLASS(GpuProfiler)
+
+public:
+    /**
+     * @brief 쿼리 결과를 읽기 전까지 돌아가며 사용하는 프레임 슬롯의 개수.
+     */
+    static constexpr std::size_t FrameCount = 4;
+
+    /**
+     * @brief 한 프레임에 측정할 수 있는 최대 구간 개수.
+     */
+    static constexpr std::size_t MaxScopesPerFrame = 32;
+
+    /**
+     * @brief 패스별로 보관하는 최근 표본의 개수.
+     */
+    static constexpr std::size_t HistoryLength = 240;
+
+    /**
+     * @brief 이름 붙은 구간을 시작합니다. 구간은 중첩할 수 있으며 EndScope와 짝을 이루어야 합니다.
+     *
+     * @param name_ 구간(패스) 이름
+     */
+    static void BeginScope(std::string_view name_) noexcept;
+
+    /**
+     * @brief 가장 최근에 시작한 구간을 끝냅니다.
+     */
+    static void EndScope() noexcept;
+
+    /**
+     * @brief GPU 타임스탬프 쿼리를 사용할 수 있는지 여부를 반환합니다.
+     *
+     * @return bool 지원 여부. false라면 CPU 시간만 측정합니다.
+     */
+    [[nodiscard]]
+    static inline bool IsSupported() noexcept
+    {
+        return isSupported;
+    }
+
+    /**
+     * @brief 결과를 읽기 전에 슬롯을 다시 사용하게 되어 버린 프레임의 개수를 반환합니다.
+     *
+     * @return std::size_t 버린 프레임의 개수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetDroppedFrameCount() noexcept
+    {
+        return droppedFrameCount;
+    }
+
+    /**
+     * @brief 패스별 최근 표본의 평균과 백분위수를 계산합니다.
+     *
+     * @return std::vector<GpuPassStatistics> 처음 측정된 순서대로 정렬된 패스별 통계
+     */
+    [[nodiscard]]
+    static std::vector<GpuPassStatistics> GetPassStatistics() noexcept;
+
+    /**
+     * @brief 패스별 GPU/CPU 통계를 로그로 출력합니다.
+     */
+    static void Dump() noexcept;
+
+private:
+    /**
+     * @struct Pass
+     *
+     * @brief 한 패스의 최근 표본들을 원형으로 보관합니다.
+     */
+    struct Pass
+    {
+        std::string                       name;
+        std::array<double, HistoryLength> gpuSamples  = {};
+        std::array<double, HistoryLength> cpuSamples  = {};
+        std::size_t                       sampleCount = 0;
+        std::size_t                       nextSample  = 0;
+    };
+
+    /**
+     * @struct Scope
+     *
+     * @brief 한 프레임에서 측정한 구간 하나를 정의합니다. 시작과 끝 쿼리는 슬롯의 2 * index, 2 * index + 1번째 쿼리입니다.
+     */
+    struct Scope
+    {
+        std::size_t                           pass = 0;
+        std::chrono::steady_clock::time_point cpuBegin;
+        double                                cpuMilliseconds = 0.0;
+        bool                                  isClosed        = false;
+    };
+
+    /**
+     * @brief 프레임당 최대 개수를 넘어 측정하지 않는 구간을 나타내는 인덱스.
+     */
+    static constexpr std::size_t InvalidScope = std::numeric_limits<std::size_t>::max();
+
+    /**
+     * @brief 쿼리 객체들을 생성하고 타임스탬프 쿼리 지원 여부를 확인합니다.
+     */
+    static void Initialize() noexcept;
+
+    /**
+     * @brief 쿼리 객체들을 해제합니다.
+     */
+    static void Release() noexcept;
+
+    /**
+     * @brief 다음 프레임 슬롯으로 넘어가며, 그 슬롯에 남아 있던 결과를 기다리지 않고 읽어 패스별 표본에 더합니다.
+     */
+    static void BeginFrame() noexcept;
+
+    /**
+     * @brief 슬롯에 기록된 구간들의 결과를 읽습니다.
+     *
+     * @param frame_ 읽을 프레임 슬롯
+     */
+    static void Resolve(std::size_t frame_) noexcept;
+
+    /**
+     * @brief 이름에 해당하는 패스를 찾고, 없다면 새로 추가합니다.
+     *
+     * @param name_ 패스 이름
+     *
+     * @return std::size_t 패스 인덱스
+     */
+    static std::size_t FindOrAddPass(std::string_view name_) noexcept;
+
+    /**
+     * @brief 프레임 슬롯별 타임스탬프 쿼리들.
+     */
+    static std::array<std::array<unsigned int, MaxScopesPerFrame * 2>, FrameCount> queries;
+
+    /**
+     * @brief 프레임 슬롯별로 기록한 구간들.
+     */
+    static std::array<std::vector<Scope>, FrameCount> scopes;
+
+    /**
+     * @brief 이번 프레임에서 아직 끝나지 않은 구간들의 인덱스.
+     */
+    static std::vector<std::size_t> openScopes;
+
+    /**
+     * @brief 측정한 패스들.
+     */
+    static std::vector<Pass> passes;
+
+    /**
+     * @brief 이번 프레임이 사용하는 슬롯의 인덱스.
+     */
+    static std::size_t frameIndex;
+
+    /**
+     * @brief 결과가 준비되지 않아 버린 프레임의 개수.
+     */
+    static std::size_t droppedFrameCount;
+
+    /**
+     * @brief GPU 타임스탬프 쿼리 지원 여부.
+     */
+    static bool isSupported;
+};
+
+/**
+ * @class GpuProfileScope
+ *
+ * @brief 생성될 때 GpuProfiler 구간을 시작하고 소멸될 때 끝냅니다.
+ */
+class GpuProfileScope final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param name_ 구간(패스) 이름
+     */
+    explicit GpuProfileScope(std::string_view name_) noexcept
+    {
+        GpuProfiler::BeginScope(name_);
+    }
+
+    /**
+     * @brief 소멸자.
+     */
+    ~GpuProfileScope() noexcept
+    {
+        GpuProfiler::EndScope();
+    }
+
+    GpuProfileScope(const GpuProfileScope&)            = delete;
+    GpuProfileScope& operator=(const GpuProfileScope&) = delete;
+};
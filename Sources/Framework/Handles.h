@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Common.h"
+
+class Component;
+class Object;
+
+/**
+ * @class HandleTable
+ *
+ * @brief 핸들의 인덱스를 실제 객체의 주소와 세대로 변환하는 테이블을 정의합니다.
+ *
+ * @tparam TBase 테이블이 관리하는 객체의 기반 타입
+ */
+template <typename TBase>
+class HandleTable final
+{
+    STATIC_CLASS(HandleTable)
+
+public:
+    /**
+     * @brief 유효하지 않은 인덱스.
+     */
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief 객체를 테이블에 등록하고 인덱스를 발급합니다.
+     *
+     * @param pointer_ 등록할 객체
+     *
+     * @return std::uint32_t 발급된 인덱스
+     */
+    static std::uint32_t Allocate(TBase* const pointer_) noexcept
+    {
+        std::uint32_t index;
+        if (!freeIndices.empty())
+        {
+            index = freeIndices.back();
+            freeIndices.pop_back();
+        }
+        else
+        {
+            index = static_cast<std::uint32_t>(entries.size());
+            entries.push_back({ nullptr, 1 });
+        }
+
+        entries[index].pointer = pointer_;
+        return index;
+    }
+
+    /**
+     * @brief 인덱스를 반환하고 세대를 올려 기존 핸들들을 무효화합니다.
+     *
+     * @param index_ 반환할 인덱스
+     */
+    static void Release(const std::uint32_t index_) noexcept
+    {
+        Entry& entry  = entries[index_];
+        entry.pointer = nullptr;
+
+        // 0세대는 기본 생성된 핸들이 사용하므로 건너뜁니다.
+        if (++entry.generation == 0)
+        {
+            entry.generation = 1;
+        }
+
+        freeIndices.push_back(index_);
+    }
+
+    /**
+     * @brief 지정한 인덱스의 현재 세대를 반환합니다.
+     *
+     * @param index_ 지정할 인덱스
+     *
+     * @return std::uint32_t 현재 세대
+     */
+    [[nodiscard]]
+    static inline std::uint32_t GetGeneration(const std::uint32_t index_) noexcept
+    {
+        return entries[index_].generation;
+    }
+
+    /**
+     * @brief 인덱스와 세대가 일치하는 객체를 반환합니다.
+     *
+     * @param index_      지정할 인덱스
+     * @param generation_ 지정할 세대
+     *
+     * @return TBase* 일치하는 객체. 이미 파괴되었다면 nullptr
+     */
+    [[nodiscard]]
+    static inline TBase* Resolve(const std::uint32_t index_, const std::uint32_t generation_) noexcept
+    {
+        if (index_ >= entries.size() || entries[index_].generation != generation_)
+        {
+            return nullptr;
+        }
+
+        return entries[index_].pointer;
+    }
+
+private:
+    /**
+     * @struct Entry
+     *
+     * @brief 테이블의 항목을 정의합니다.
+     */
+    struct Entry
+    {
+        TBase*        pointer;
+        std::uint32_t generation;
+    };
+
+    /**
+     * @brief 테이블의 항목들.
+     */
+    static inline std::vector<Entry> entries;
+
+    /**
+     * @brief 재사용할 수 있는 인덱스들.
+     */
+    static inline std::vector<std::uint32_t> freeIndices;
+};
+
+/**
+ * @class Handle
+ *
+ * @brief 인덱스와 세대로 이루어진 64비트 핸들을 정의합니다.
+ *        객체가 파괴된 뒤에는 nullptr로 해석되므로, 오래 보관할 참조는 원시 포인터 대신 핸들을 사용합니다.
+ *
+ * @tparam T 참조할 타입 (Object 또는 Component의 파생 타입)
+ */
+template <typename T>
+class Handle final
+{
+public:
+    /**
+     * @brief 기본 생성자. 아무것도 참조하지 않는 핸들을 생성합니다.
+     */
+    Handle() noexcept
+        : index(HandleTable<Object>::InvalidIndex)
+        , generation(0)
+    {
+    }
+
+    /**
+     * @brief 생성자.
+     *
+     * @param pointer_ 참조할 객체
+     */
+    Handle(T* const pointer_) noexcept
+        : Handle()
+    {
+        if (pointer_)
+        {
+            index      = pointer_->GetHandleIndex();
+            generation = Table::GetGeneration(index);
+        }
+    }
+
+    /**
+     * @brief 참조하는 객체를 반환합니다.
+     *
+     * @return T* 참조하는 객체. 이미 파괴되었다면 nullptr
+     */
+    [[nodiscard]]
+    inline T* Get() const noexcept
+    {
+        return static_cast<T*>(Table::Resolve(index, generation));
+    }
+
+    inline T* operator->() const noexcept
+    {
+        return Get();
+    }
+
+    inline explicit operator bool() const noexcept
+    {
+        return Get() != nullptr;
+    }
+
+    inline bool operator==(const Handle&) const noexcept = default;
+
+    /**
+     * @brief 아무것도 참조하지 않도록 초기화합니다.
+     */
+    inline void Reset() noexcept
+    {
+        *this = Handle();
+    }
+
+private:
+    /**
+     * @brief 참조할 타입에 맞는 핸들 테이블.
+     */
+    using Table = HandleTable<std::conditional_t<std::is_base_of_v<Component, T>, Component, Object>>;
+
+    /**
+     * @brief 핸들 테이블의 인덱스.
+     */
+    std::uint32_t index;
+
+    /**
+     * @brief 핸들이 발급될 때의 세대.
+     */
+    std::uint32_t generation;
+};
@@ -0,0 +1,166 @@
+#include "Jobs.h"
+
+void JobSystem::Initialize(std::size_t threadCount_) noexcept
+{
+    Shutdown();
+
+    if (threadCount_ == 0)
+    {
+        threadCount_ = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    const std::size_t workerCount = threadCount_ - 1;
+
+    queues.clear();
+    for (std::size_t index = 0; index <= workerCount; ++index)
+    {
+        queues.emplace_back(std::make_unique<Queue>());
+    }
+
+    isRunning.store(true, std::memory_order_release);
+    threadQueueIndex = 0;
+
+    workers.reserve(workerCount);
+    for (std::size_t index = 1; index <= workerCount; ++index)
+    {
+        workers.emplace_back(&JobSystem::WorkerMain, index);
+    }
+}
+
+void JobSystem::Shutdown() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        isRunning.store(false, std::memory_order_release);
+    }
+    wakeCondition.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    workers.clear();
+}
+
+void JobSystem::ParallelFor(const std::size_t count_, std::size_t grainSize_, const RangeFunction& function_) noexcept
+{
+    if (count_ == 0)
+    {
+        return;
+    }
+
+    grainSize_                 = std::max<std::size_t>(grainSize_, 1);
+    const std::size_t jobCount = (count_ + grainSize_ - 1) / grainSize_;
+
+    // 작업 스레드가 없거나 작업이 하나뿐이라면 나누지 않고 바로 처리합니다.
+    if (workers.empty() || jobCount == 1)
+    {
+        function_(0, count_);
+        return;
+    }
+
+    std::atomic<std::size_t> remaining(jobCount);
+
+    // 작업들을 모든 큐에 고르게 나누어 넣고, 먼저 끝난 스레드가 나머지를 훔쳐 가도록 합니다.
+    const std::size_t queueCount = queues.size();
+    for (std::size_t job = 0; job < jobCount; ++job)
+    {
+        const std::size_t begin = job * grainSize_;
+        const std::size_t end   = std::min(begin + grainSize_, count_);
+
+        Queue& queue = *queues[(threadQueueIndex + job) % queueCount];
+        {
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.jobs.push_back({ &function_, begin, end, &remaining });
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(sleepMutex);
+        queuedJobCount.fetch_add(jobCount, std::memory_order_release);
+    }
+    wakeCondition.notify_all();
+
+    // 기다리는 동안 호출한 스레드도 작업을 처리합니다.
+    while (remaining.load(std::memory_order_acquire) != 0)
+    {
+        if (!TryRunJob(threadQueueIndex))
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void JobSystem::WorkerMain(const std::size_t queueIndex_) noexcept
+{
+    threadQueueIndex = queueIndex_;
+
+    while (isRunning.load(std::memory_order_acquire))
+    {
+        if (TryRunJob(queueIndex_))
+        {
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(sleepMutex);
+        wakeCondition.wait(lock, [] {
+            return queuedJobCount.load(std::memory_order_acquire) != 0 || !isRunning.load(std::memory_order_acquire);
+        });
+    }
+}
+
+bool JobSystem::TryRunJob(const std::size_t queueIndex_) noexcept
+{
+    Job job{};
+    bool hasJob = false;
+
+    // 1. 자신의 큐에서 가장 최근에 넣은 작업을 꺼냅니다.
+    {
+        Queue&                      queue = *queues[queueIndex_];
+        std::lock_guard<std::mutex> lock(queue.mutex);
+        if (!queue.jobs.empty())
+        {
+            job = queue.jobs.back();
+            queue.jobs.pop_back();
+            hasJob = true;
+        }
+    }
+
+    // 2. 자신의 큐가 비었다면 다른 큐에서 가장 오래된 작업을 훔쳐 옵니다.
+    const std::size_t queueCount = queues.size();
+    for (std::size_t offset = 1; !hasJob && offset < queueCount; ++offset)
+    {
+        Queue&                      victim = *queues[(queueIndex_ + offset) % queueCount];
+        std::lock_guard<std::mutex> lock(victim.mutex);
+        if (!victim.jobs.empty())
+        {
+            job = victim.jobs.front();
+            victim.jobs.pop_front();
+            hasJob = true;
+
+            stolenJobCount.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (!hasJob)
+    {
+        return false;
+    }
+
+    queuedJobCount.fetch_sub(1, std::memory_order_acq_rel);
+
+    (*job.function)(job.begin, job.end);
+    job.remaining->fetch_sub(1, std::memory_order_acq_rel);
+
+    return true;
+}
+
+std::vector<std::thread>                       JobSystem::workers;
+std::vector<std::unique_ptr<JobSystem::Queue>> JobSystem::queues;
+std::mutex                                     JobSystem::sleepMutex;
+std::condition_variable                        JobSystem::wakeCondition;
+std::atomic<std::size_t>                       JobSystem::queuedJobCount   = 0;
+std::atomic<std::size_t>                       JobSystem::stolenJobCount   = 0;
+std::atomic<bool>                              JobSystem::isRunning        = false;
+thread_local std::size_t                       JobSystem::threadQueueIndex = 0;
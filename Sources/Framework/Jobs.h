@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Common.h"
+
+/**
+ * @class JobSystem
+ *
+ * @brief 작업 훔치기(work stealing) 방식으로 작업을 여러 스레드에 분배하는 작업 시스템을 정의합니다.
+ *        메인 스레드는 0번 큐를 사용하며, 작업이 끝나기를 기다리는 동안 직접 작업을 처리합니다.
+ */
+class JobSystem final
+{
+    STATIC_CLASS(JobSystem)
+
+public:
+    /**
+     * @brief 구간 [begin, end)를 처리하는 작업 함수를 정의합니다.
+     */
+    using RangeFunction = std::function<void(std::size_t, std::size_t)>;
+
+    /**
+     * @brief 작업 시스템을 초기화합니다.
+     *
+     * @param threadCount_ 메인 스레드를 포함한 전체 스레드의 개수. 0이라면 하드웨어 스레드 개수를 사용합니다.
+     */
+    static void Initialize(std::size_t threadCount_ = 0) noexcept;
+
+    /**
+     * @brief 모든 작업 스레드를 종료합니다.
+     */
+    static void Shutdown() noexcept;
+
+    /**
+     * @brief 구간 [0, count)를 grainSize 단위로 나누어 병렬로 처리하고, 모두 끝날 때까지 기다립니다.
+     *
+     * @param count_     처리할 원소의 개수
+     * @param grainSize_ 작업 하나가 처리할 원소의 개수
+     * @param function_  구간을 처리할 함수
+     */
+    static void ParallelFor(std::size_t count_, std::size_t grainSize_, const RangeFunction& function_) noexcept;
+
+    /**
+     * @brief 메인 스레드를 포함한 전체 스레드의 개수를 반환합니다.
+     *
+     * @return std::size_t 전체 스레드의 개수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetThreadCount() noexcept
+    {
+        return workers.size() + 1;
+    }
+
+    /**
+     * @brief 지금까지 다른 스레드의 큐에서 훔쳐 온 작업의 개수를 반환합니다.
+     *
+     * @return std::size_t 훔쳐 온 작업의 개수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetStolenJobCount() noexcept
+    {
+        return stolenJobCount.load(std::memory_order_relaxed);
+    }
+
+private:
+    /**
+     * @struct Job
+     *
+     * @brief 작업 하나를 정의합니다.
+     */
+    struct Job
+    {
+        /**
+         * @brief 구간을 처리할 함수.
+         */
+        const RangeFunction* function;
+
+        /**
+         * @brief 처리할 구간의 시작.
+         */
+        std::size_t begin;
+
+        /**
+         * @brief 처리할 구간의 끝.
+         */
+        std::size_t end;
+
+        /**
+         * @brief 같은 ParallelFor에서 아직 끝나지 않은 작업의 개수.
+         */
+        std::atomic<std::size_t>* remaining;
+    };
+
+    /**
+     * @struct Queue
+     *
+     * @brief 스레드마다 하나씩 가지는 작업 큐를 정의합니다.
+     *        소유한 스레드는 뒤에서 꺼내고, 다른 스레드는 앞에서 훔쳐 갑니다.
+     */
+    struct Queue
+    {
+        std::mutex      mutex;
+        std::deque<Job> jobs;
+    };
+
+    /**
+     * @brief 작업 스레드의 진입점입니다.
+     *
+     * @param queueIndex_ 작업 스레드가 소유한 큐의 인덱스
+     */
+    static void WorkerMain(std::size_t queueIndex_) noexcept;
+
+    /**
+     * @brief 자신의 큐 또는 다른 스레드의 큐에서 작업 하나를 꺼내어 실행합니다.
+     *
+     * @param queueIndex_ 호출한 스레드가 소유한 큐의 인덱스
+     *
+     * @return bool 작업을 실행했는지 여부
+     */
+    static bool TryRunJob(std::size_t queueIndex_) noexcept;
+
+    /**
+     * @brief 작업 스레드들.
+     */
+    static std::vector<std::thread> workers;
+
+    /**
+     * @brief 스레드별 작업 큐들. 0번은 메인 스레드의 큐입니다.
+     */
+    static std::vector<std::unique_ptr<Queue>> queues;
+
+    /**
+     * @brief 대기 중인 작업 스레드를 깨우기 위한 뮤텍스.
+     */
+    static std::mutex sleepMutex;
+
+    /**
+     * @brief 대기 중인 작업 스레드를 깨우기 위한 조건 변수.
+     */
+    static std::condition_variable wakeCondition;
+
+    /**
+     * @brief 큐에 들어 있는 작업의 개수.
+     */
+    static std::atomic<std::size_t> queuedJobCount;
+
+    /**
+     * @brief 지금까지 훔쳐 온 작업의 개수.
+     */
+    static std::atomic<std::size_t> stolenJobCount;
+
+    /**
+     * @brief 작업 시스템이 실행 중인지 여부.
+     */
+    static std::atomic<bool> isRunning;
+
+    /**
+     * @brief 현재 스레드가 소유한 큐의 인덱스.
+     */
+    static thread_local std::size_t threadQueueIndex;
+};
@@ -0,0 +1,251 @@
+#pragma once
+
+#include "Common.h"
+
+/**
+ * @struct PoolStatistics
+ *
+ * @brief 풀 할당 통계를 정의합니다.
+ */
+struct PoolStatistics
+{
+    /**
+     * @brief 풀에서 할당한 횟수.
+     */
+    std::size_t allocationCount = 0;
+
+    /**
+     * @brief 풀로 반환한 횟수.
+     */
+    std::size_t releaseCount = 0;
+
+    /**
+     * @brief 범용 할당기에서 청크를 할당한 횟수.
+     */
+    std::size_t chunkCount = 0;
+
+    /**
+     * @brief 범용 할당기에서 할당한 청크들의 총 바이트 수.
+     */
+    std::size_t chunkBytes = 0;
+
+    /**
+     * @brief 현재 사용 중인 슬롯의 개수를 반환합니다.
+     *
+     * @return std::size_t 현재 사용 중인 슬롯의 개수
+     */
+    [[nodiscard]]
+    inline std::size_t GetLiveCount() const noexcept
+    {
+        return allocationCount - releaseCount;
+    }
+};
+
+/**
+ * @class PoolManager
+ *
+ * @brief 타입별 풀 할당기들의 할당 통계를 관리합니다.
+ */
+class PoolManager final
+{
+    template <typename T>
+    friend class Pool;
+
+    STATIC_CLASS(PoolManager)
+
+public:
+    /**
+     * @brief 모든 풀의 누적 할당 통계를 반환합니다.
+     *
+     * @return const PoolStatistics& 누적 할당 통계
+     */
+    [[nodiscard]]
+    static inline const PoolStatistics& GetStatistics() noexcept
+    {
+        return statistics;
+    }
+
+private:
+    /**
+     * @brief 모든 풀의 누적 할당 통계.
+     */
+    static inline PoolStatistics statistics;
+};
+
+/**
+ * @struct PoolDeleter
+ *
+ * @brief 풀에서 할당한 객체를 원래의 풀로 반환하는 삭제자를 정의합니다.
+ *
+ * @tparam TBase 삭제할 포인터의 타입
+ */
+template <typename TBase>
+struct PoolDeleter
+{
+    /**
+     * @brief 실제 타입의 풀로 객체를 반환하는 함수.
+     */
+    void (*release)(TBase* const) noexcept = nullptr;
+
+    void operator()(TBase* const pointer_) const noexcept
+    {
+        release(pointer_);
+    }
+};
+
+/**
+ * @brief 풀에서 할당한 객체를 소유하는 포인터를 정의합니다.
+ */
+template <typename TBase>
+using PoolPtr = std::unique_ptr<TBase, PoolDeleter<TBase>>;
+
+/**
+ * @class Pool
+ *
+ * @brief 지정한 타입 전용의 청크 기반 풀 할당기를 정의합니다.
+ *
+ * @tparam T 할당할 타입
+ */
+template <typename T>
+class Pool final
+{
+    STATIC_CLASS(Pool)
+
+public:
+    /**
+     * @brief 풀에서 객체를 생성합니다.
+     *
+     * @tparam TBase 반환할 포인터의 타입
+     * @tparam TArgs 생성자 인자의 타입들
+     *
+     * @param args_ 생성자 인자들
+     *
+     * @return PoolPtr<TBase> 생성된 객체
+     */
+    template <typename TBase = T, typename... TArgs>
+    [[nodiscard]]
+    static PoolPtr<TBase> Make(TArgs&&... args_)
+    {
+        static_assert(std::is_base_of_v<TBase, T>, "T must derive from TBase.");
+
+        if (!freeList)
+        {
+            Grow();
+        }
+
+        Slot* const slot = freeList;
+        freeList         = slot->next;
+
+        T* const object = new (slot->storage) T(std::forward<TArgs>(args_)...);
+
+        ++liveCount;
+        ++PoolManager::statistics.allocationCount;
+
+        return PoolPtr<TBase>(object, PoolDeleter<TBase>{ &Release<TBase> });
+    }
+
+    /**
+     * @brief 현재 사용 중인 슬롯의 개수를 반환합니다.
+     *
+     * @return std::size_t 현재 사용 중인 슬롯의 개수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetLiveCount() noexcept
+    {
+        return liveCount;
+    }
+
+    /**
+     * @brief 할당된 청크들의 총 슬롯 개수를 반환합니다.
+     *
+     * @return std::size_t 총 슬롯 개수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetCapacity() noexcept
+    {
+        return capacity;
+    }
+
+private:
+    /**
+     * @union Slot
+     *
+     * @brief 비어 있을 때는 다음 빈 슬롯을, 사용 중일 때는 객체를 담는 슬롯을 정의합니다.
+     */
+    union Slot
+    {
+        Slot* next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    /**
+     * @brief 첫 번째 청크의 슬롯 개수.
+     */
+    static constexpr std::size_t MinChunkSize = 16;
+
+    /**
+     * @brief 청크 하나의 최대 슬롯 개수.
+     */
+    static constexpr std::size_t MaxChunkSize = 1024;
+
+    /**
+     * @brief 객체를 소멸시키고 슬롯을 풀로 반환합니다.
+     *
+     * @param pointer_ 반환할 객체
+     */
+    template <typename TBase>
+    static void Release(TBase* const pointer_) noexcept
+    {
+        T* const object = static_cast<T*>(pointer_);
+        object->~T();
+
+        Slot* const slot = reinterpret_cast<Slot*>(object);
+        slot->next       = freeList;
+        freeList         = slot;
+
+        --liveCount;
+        ++PoolManager::statistics.releaseCount;
+    }
+
+    /**
+     * @brief 새 청크를 할당하여 빈 슬롯 목록에 연결합니다.
+     */
+    static void Grow()
+    {
+        // 청크의 크기를 두 배씩 늘려 적게 쓰이는 타입의 낭비를 줄입니다.
+        const std::size_t slotCount = std::min(MinChunkSize << std::min<std::size_t>(chunks.size(), 6), MaxChunkSize);
+
+        std::unique_ptr<Slot[]> chunk = std::make_unique<Slot[]>(slotCount);
+        for (std::size_t index = 0; index < slotCount; ++index)
+        {
+            chunk[index].next = index + 1 < slotCount ? &chunk[index + 1] : freeList;
+        }
+
+        freeList = &chunk[0];
+        capacity += slotCount;
+        chunks.emplace_back(std::move(chunk));
+
+        ++PoolManager::statistics.chunkCount;
+        PoolManager::statistics.chunkBytes += slotCount * sizeof(Slot);
+    }
+
+    /**
+     * @brief 범용 할당기에서 할당한 청크들.
+     */
+    static inline std::vector<std::unique_ptr<Slot[]>> chunks;
+
+    /**
+     * @brief 빈 슬롯 목록의 첫 번째 슬롯.
+     */
+    static inline Slot* freeList = nullptr;
+
+    /**
+     * @brief 현재 사용 중인 슬롯의 개수.
+     */
+    static inline std::size_t liveCount = 0;
+
+    /**
+     * @brief 할당된 청크들의 총 슬롯 개수.
+     */
+    static inline std::size_t capacity = 0;
+};
@@ -1,8 +1,15 @@
 #include "Objects.h"
 
+#include "Debug.h"
+#include "Scenes.h"
+
 Component::Component(Object* const owner_) 
     : owner(owner_)
     , transform(owner_->GetTransform())
+    , handleIndex(HandleTable<Component>::Allocate(this))
+    , typeIndex(0)
+    , typeID(0)
+    , hooks(0)
     , isEnabled(true)
     , isStarted(false)
     , isDestroyed(false)
@@ -11,12 +18,39 @@ Component::Component(Object* const owner_)
 
 Component::~Component() noexcept
 {
+    HandleTable<Component>::Release(handleIndex);
+}
+
+void Component::Destroy() noexcept
+{
+    // 트랜스폼은 오브젝트와 함께만 파괴됩니다.
+    if (isDestroyed || this == owner->GetTransform())
+    {
+        return;
+    }
+
+    isDestroyed = true;
+
+    if (Scene* const scene = owner->GetScene())
+    {
+        scene->QueueDestroy(this);
+    }
 }
 
 Object::Object(std::string_view name_, std::string_view tag_) noexcept
-    : name(name_)
-    , tag(tag_)
+    : name(NameRegistry::Intern(name_))
+    , tag(NameRegistry::Intern(tag_))
+    , transform(nullptr)
+    , componentSlots{}
+    , componentMask()
+    , handleIndex(HandleTable<Object>::Allocate(this))
+    , sceneIndex(0)
+    , tagIndex(0)
+    , scene(nullptr)
+    , layer(0)
+    , isUI(false)
     , isEnabled(true)
+    , isStatic(false)
     , isDestroyed(false)
 {
     // 기본 컴포넌트로 Transform 추가
@@ -27,91 +61,392 @@ Object::~Object() noexcept
 {
     for (auto& component : components)
     {
-        component->Destroy();
+        component->isDestroyed = true;
     }
+
+    HandleTable<Object>::Release(handleIndex);
 }
 
-void Object::Start() noexcept
+void Object::Destroy() noexcept
 {
-    if (!isEnabled)
+    if (isDestroyed)
     {
         return;
     }
 
-    for (const std::unique_ptr<Component>& component : components)
+    isDestroyed = true;
+
+    if (scene)
     {
-        if (component->IsEnabled() && !component->IsDestroyed())
-        {
-            component->Start();
-            component->SetStarted();
-        }
+        scene->QueueDestroy(this);
     }
 }
 
-void Object::Update() noexcept
+void Object::SetTag(std::string_view tag_) noexcept
 {
-    if (!isEnabled)
+    const NameID newTag = NameRegistry::Intern(tag_);
+    if (tag == newTag)
     {
         return;
     }
 
-    for (const std::unique_ptr<Component>& component : components)
+    // 씬의 태그 색인도 함께 옮깁니다.
+    const bool isIndexed = scene && !isDestroyed;
+    if (isIndexed)
     {
-        if (component->IsEnabled() && !component->IsDestroyed())
-        {
-            if (!component->IsStarted())
-            {
-                component->Start();
-                component->SetStarted();
-            }
+        scene->UnindexObject(this);
+    }
 
-            component->Update();
-            component->LateUpdate();
-        }
+    tag = newTag;
+
+    if (isIndexed)
+    {
+        scene->IndexObject(this);
     }
 }
 
-void Object::FixedUpdate() noexcept
+void Object::SetStatic(const bool static_) noexcept
 {
-    if (!isEnabled)
+    if (isStatic == static_)
     {
         return;
     }
 
-    for (const std::unique_ptr<Component>& component : components)
+    isStatic = static_;
+    TransformManager::SetStatic(transform->index, static_);
+
+    // 씬의 호출 목록과 렌더링 버킷도 함께 옮깁니다.
+    if (scene && !isDestroyed)
     {
-        if (component->IsEnabled() && !component->IsDestroyed())
-        {
-            component->FixedUpdate();
-        }
+        scene->ChangeStatic(this);
     }
 }
 
-void Object::Render() noexcept
+void Object::SetLayer(const std::uint8_t layer_) noexcept
 {
-    if (!isEnabled)
+    if (layer_ >= LayerCount)
     {
+        Logger::Error("Layer {} is out of range for object '{}'.", layer_, GetWindowTitle());
         return;
     }
 
-    for (const std::unique_ptr<Component>& component : components)
+    if (layer == layer_)
     {
-        if (component->IsEnabled() && !component->IsDestroyed())
-        {
-            component->Render();
-        }
+        return;
+    }
+
+    layer = layer_;
+
+    // 렌더링 버킷은 레이어별로 묶이므로 다시 묶도록 합니다.
+    if (scene && !isDestroyed)
+    {
+        scene->InvalidateRenderBuckets();
     }
 }
 
+void Object::RegisterComponent(Component* const component_) noexcept
+{
+    // 씬에 추가되기 전에 붙은 컴포넌트들은 씬에 추가될 때 함께 등록됩니다.
+    if (scene)
+    {
+        scene->RegisterComponent(component_);
+    }
+}
+
+void Object::ReleaseComponent(Component* const component_) noexcept
+{
+    const auto iter = std::find_if(components.begin(),
+                                   components.end(),
+                                   [component_](const PoolPtr<Component>& component) { return component.get() == component_; });
+    if (iter == components.end())
+    {
+        return;
+    }
+
+    componentSlots[component_->typeID] = nullptr;
+    componentMask.reset(component_->typeID);
+
+    // 컴포넌트의 순서는 의미가 없으므로 마지막 컴포넌트와 바꾼 뒤 제거합니다.
+    std::iter_swap(iter, components.end() - 1);
+    components.pop_back();
+}
+
+NameID NameRegistry::Intern(std::string_view name_) noexcept
+{
+    if (const auto iter = ids.find(name_); iter != ids.end())
+    {
+        return iter->second;
+    }
+
+    const NameID id = static_cast<NameID>(names.size());
+    names.emplace_back(name_);
+    ids.emplace(names.back(), id);
+
+    return id;
+}
+
+NameID NameRegistry::Find(std::string_view name_) noexcept
+{
+    const auto iter = ids.find(name_);
+    return iter != ids.end() ? iter->second : InvalidID;
+}
+
 Transform::Transform(Object* const owner)
     : Component(owner)
-    , position(0.0f, 0.0f, 0.0f)
-    , rotation(glm::vec3(0.0f, 0.0f, 0.0f))
-    , scale(1.0f, 1.0f, 1.0f)
+    , index(TransformManager::Allocate())
     , parent(nullptr)
 {
 }
 
 Transform::~Transform() noexcept
 {
-}
\ No newline at end of file
+    SetParent(nullptr);
+
+    for (Transform* const child : children)
+    {
+        child->parent                           = nullptr;
+        TransformManager::parents[child->index] = TransformManager::InvalidIndex;
+        child->MarkWorldDirty();
+    }
+    children.clear();
+
+    TransformManager::Release(index);
+}
+
+void Transform::SetParent(Transform* const parent_) noexcept
+{
+    if (parent == parent_)
+    {
+        return;
+    }
+
+    if (parent)
+    {
+        std::erase(parent->children, this);
+    }
+
+    parent = parent_;
+
+    if (parent)
+    {
+        parent->children.push_back(this);
+    }
+
+    TransformManager::parents[index] = parent ? parent->index : TransformManager::InvalidIndex;
+    TransformManager::isOrderDirty   = true;
+
+    MarkWorldDirty();
+}
+
+void Transform::MarkWorldDirty() noexcept
+{
+    TransformManager::dirtyFlags[index] |= TransformManager::WorldDirty;
+
+    for (Transform* const child : children)
+    {
+        // 이미 무효화된 트랜스폼이라면 그 하위 트랜스폼들도 모두 무효화된 상태입니다.
+        if (!(TransformManager::dirtyFlags[child->index] & TransformManager::WorldDirty))
+        {
+            child->MarkWorldDirty();
+        }
+    }
+}
+
+void TransformManager::UpdateWorldMatrices() noexcept
+{
+    if (isOrderDirty)
+    {
+        RebuildUpdateOrder();
+    }
+
+    // 부모가 항상 먼저 처리되므로, 변경된 트랜스폼만 자기 자신을 다시 계산하면 됩니다.
+    for (const std::uint32_t index : updateOrder)
+    {
+        if (dirtyFlags[index] != 0)
+        {
+            Resolve(index);
+        }
+    }
+}
+
+void TransformManager::Resolve(const std::uint32_t index_) noexcept
+{
+    std::uint8_t& flags = dirtyFlags[index_];
+
+    if (flags & LocalDirty)
+    {
+        glm::fmat4x4 localMatrix(1.0f);
+        localMatrix = glm::translate(localMatrix, positions[index_]);
+        localMatrix *= glm::mat4_cast(rotations[index_]);
+        localMatrix = glm::scale(localMatrix, scales[index_]);
+
+        localMatrices[index_] = localMatrix;
+    }
+
+    if (flags & WorldDirty)
+    {
+        const std::uint32_t parent = parents[index_];
+        if (parent != InvalidIndex)
+        {
+            if (dirtyFlags[parent] != 0)
+            {
+                Resolve(parent);
+            }
+
+            worldMatrices[index_] = worldMatrices[parent] * localMatrices[index_];
+        }
+        else
+        {
+            worldMatrices[index_] = localMatrices[index_];
+        }
+
+        ++versions[index_];
+    }
+
+    flags = 0;
+}
+
+std::uint32_t TransformManager::Allocate() noexcept
+{
+    std::uint32_t index;
+
+    if (!freeIndices.empty())
+    {
+        index = freeIndices.back();
+        freeIndices.pop_back();
+    }
+    else
+    {
+        index = static_cast<std::uint32_t>(positions.size());
+
+        positions.emplace_back();
+        rotations.emplace_back();
+        scales.emplace_back();
+        localMatrices.emplace_back();
+        worldMatrices.emplace_back();
+        dirtyFlags.emplace_back();
+        versions.emplace_back();
+        parents.emplace_back();
+        isAlive.emplace_back();
+        isStatic.emplace_back();
+    }
+
+    positions[index]     = glm::fvec3(0.0f, 0.0f, 0.0f);
+    rotations[index]     = glm::fquat(glm::fvec3(0.0f, 0.0f, 0.0f));
+    scales[index]        = glm::fvec3(1.0f, 1.0f, 1.0f);
+    localMatrices[index] = glm::fmat4x4(1.0f);
+    worldMatrices[index] = glm::fmat4x4(1.0f);
+    dirtyFlags[index]    = LocalDirty | WorldDirty;
+    parents[index]       = InvalidIndex;
+    isAlive[index]       = true;
+    isStatic[index]      = false;
+
+    isOrderDirty = true;
+
+    return index;
+}
+
+void TransformManager::Release(const std::uint32_t index_) noexcept
+{
+    isAlive[index_] = false;
+    parents[index_] = InvalidIndex;
+    freeIndices.push_back(index_);
+
+    isOrderDirty = true;
+}
+
+void TransformManager::SetStatic(const std::uint32_t index_, const bool static_) noexcept
+{
+    // 정적 트랜스폼이 되기 전에 마지막으로 한 번 계산해 둡니다.
+    if (static_ && dirtyFlags[index_] != 0)
+    {
+        Resolve(index_);
+    }
+
+    isStatic[index_] = static_;
+    isOrderDirty     = true;
+}
+
+void TransformManager::RebuildUpdateOrder() noexcept
+{
+    const std::uint32_t count = static_cast<std::uint32_t>(positions.size());
+
+    // 각 트랜스폼의 깊이(루트 = 0)를 계산합니다.
+    std::vector<std::uint32_t> depths(count, InvalidIndex);
+    std::uint32_t              maxDepth = 0;
+
+    for (std::uint32_t index = 0; index < count; ++index)
+    {
+        if (!isAlive[index])
+        {
+            continue;
+        }
+
+        std::uint32_t depth   = 0;
+        std::uint32_t current = parents[index];
+        while (current != InvalidIndex && depths[current] == InvalidIndex)
+        {
+            ++depth;
+            current = parents[current];
+        }
+
+        if (current != InvalidIndex)
+        {
+            depth += depths[current] + 1;
+        }
+
+        // 이번에 거쳐 온 조상들의 깊이도 함께 기록해 둡니다.
+        for (std::uint32_t node = index; node != current; node = parents[node])
+        {
+            depths[node] = depth--;
+        }
+
+        maxDepth = std::max(maxDepth, depths[index]);
+    }
+
+    // 깊이 순으로 계수 정렬하여 부모가 항상 자식보다 먼저 갱신되도록 합니다.
+    // 정적 트랜스폼은 깊이 계산에만 참여하고 갱신 순서에서는 제외됩니다.
+    const auto isUpdated = [](const std::uint32_t index_) { return isAlive[index_] && !isStatic[index_]; };
+
+    std::vector<std::uint32_t> offsets(maxDepth + 2, 0);
+    for (std::uint32_t index = 0; index < count; ++index)
+    {
+        if (isUpdated(index))
+        {
+            ++offsets[depths[index] + 1];
+        }
+    }
+
+    for (std::size_t depth = 1; depth < offsets.size(); ++depth)
+    {
+        offsets[depth] += offsets[depth - 1];
+    }
+
+    updateOrder.resize(offsets.back());
+    for (std::uint32_t index = 0; index < count; ++index)
+    {
+        if (isUpdated(index))
+        {
+            updateOrder[offsets[depths[index]]++] = index;
+        }
+    }
+
+    isOrderDirty = false;
+}
+
+std::vector<glm::fvec3>    TransformManager::positions;
+std::vector<glm::fquat>    TransformManager::rotations;
+std::vector<glm::fvec3>    TransformManager::scales;
+std::vector<glm::fmat4x4>  TransformManager::localMatrices;
+std::vector<glm::fmat4x4>  TransformManager::worldMatrices;
+std::vector<std::uint8_t>  TransformManager::dirtyFlags;
+std::vector<std::uint32_t> TransformManager::versions;
+std::vector<std::uint32_t> TransformManager::parents;
+std::vector<std::uint8_t>  TransformManager::isAlive;
+std::vector<std::uint8_t>  TransformManager::isStatic;
+std::vector<std::uint32_t> TransformManager::freeIndices;
+std::vector<std::uint32_t> TransformManager::updateOrder;
+bool                       TransformManager::isOrderDirty = false;
+
+std::deque<std::string>                      NameRegistry::names;
+std::unordered_map<std::string_view, NameID> NameRegistry::ids;
@@ -1,9 +1,12 @@
 #pragma once
 
 #include "Common.h"
+#include "Handles.h"
+#include "Memory.h"
 
 class Component;
 class Object;
+class Scene;
 class Transform;
 
 /**
@@ -19,53 +22,247 @@ template <typename TObject>
 concept FromObject = std::derived_from<TObject, Object>;
 
 /**
- * @class Object
+ * @brief 컴포넌트 타입 ID를 정의합니다.
+ */
+using ComponentTypeID = std::uint32_t;
+
+/**
+ * @brief 등록할 수 있는 컴포넌트 타입의 최대 개수.
+ */
+inline constexpr ComponentTypeID MaxComponentTypes = 64;
+
+/**
+ * @brief 컴포넌트가 재정의한 생명주기 함수들의 비트마스크를 정의합니다.
+ */
+using ComponentHooks = std::uint8_t;
+
+/**
+ * @class ComponentRegistry
  *
- * @brief 오브젝트를 정의합니다.
+ * @brief 컴포넌트 타입마다 0부터 시작하는 조밀한 타입 ID를 발급합니다.
  */
-class Object
+class ComponentRegistry final
 {
+    STATIC_CLASS(ComponentRegistry)
+
 public:
     /**
-     * @brief 생성자.
+     * @brief 지정한 컴포넌트 타입의 ID를 반환합니다.
      *
-     * @param name_ 생성할 오브젝트의 이름
-     * @param tag_  생성할 오브젝트의 태그
+     * @tparam TComponent 지정할 타입
+     *
+     * @return ComponentTypeID 지정한 컴포넌트 타입의 ID
      */
-    Object(std::string_view name_ = "New Object", std::string_view tag_ = "Not tag") noexcept;
+    template <FromComponent TComponent>
+    [[nodiscard]]
+    static ComponentTypeID GetTypeID() noexcept
+    {
+        static const ComponentTypeID typeID = nextTypeID.fetch_add(1, std::memory_order_relaxed);
+        return typeID;
+    }
 
     /**
-     * @brief 소멸자.
+     * @brief 지금까지 발급된 컴포넌트 타입 ID의 개수를 반환합니다.
+     *
+     * @return ComponentTypeID 발급된 컴포넌트 타입 ID의 개수
      */
-    virtual ~Object() noexcept;
+    [[nodiscard]]
+    static inline ComponentTypeID GetTypeCount() noexcept
+    {
+        return nextTypeID.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 지정한 컴포넌트 타입이 재정의한 생명주기 함수들을 컴파일 타임에 검사합니다.
+     *
+     * @tparam TComponent 지정할 타입
+     *
+     * @return ComponentHooks 재정의된 생명주기 함수들의 비트마스크
+     */
+    template <FromComponent TComponent>
+    [[nodiscard]]
+    static constexpr ComponentHooks GetHooks() noexcept
+    {
+        const ComponentHooks parallelHook = TComponent::IsParallelSafe ? ParallelHook : 0;
+
+        if constexpr (std::is_final_v<TComponent>)
+        {
+            // 상속할 수 없는 타입은 재정의 여부를 검사할 수 없으므로 모든 함수를 호출합니다.
+            return AllHooks | parallelHook;
+        }
+        else
+        {
+            // 재정의되지 않은 함수의 멤버 포인터는 Component의 멤버 포인터 타입을 그대로 가집니다.
+            struct Probe : TComponent
+            {
+                static constexpr ComponentHooks Get() noexcept
+                {
+                    ComponentHooks hooks = 0;
+                    hooks |= std::is_same_v<decltype(&Probe::Start), void (Component::*)()> ? 0 : StartHook;
+                    hooks |= std::is_same_v<decltype(&Probe::Update), void (Component::*)()> ? 0 : UpdateHook;
+                    hooks |= std::is_same_v<decltype(&Probe::FixedUpdate), void (Component::*)()> ? 0 : FixedUpdateHook;
+                    hooks |= std::is_same_v<decltype(&Probe::LateUpdate), void (Component::*)()> ? 0 : LateUpdateHook;
+                    hooks |= std::is_same_v<decltype(&Probe::Render), void (Component::*)()> ? 0 : RenderHook;
+                    return hooks;
+                }
+            };
+
+            return Probe::Get() | parallelHook;
+        }
+    }
+
+    /**
+     * @brief Start 함수를 재정의했음을 나타냅니다.
+     */
+    static constexpr ComponentHooks StartHook = 1 << 0;
+
+    /**
+     * @brief Update 함수를 재정의했음을 나타냅니다.
+     */
+    static constexpr ComponentHooks UpdateHook = 1 << 1;
+
+    /**
+     * @brief FixedUpdate 함수를 재정의했음을 나타냅니다.
+     */
+    static constexpr ComponentHooks FixedUpdateHook = 1 << 2;
+
+    /**
+     * @brief LateUpdate 함수를 재정의했음을 나타냅니다.
+     */
+    static constexpr ComponentHooks LateUpdateHook = 1 << 3;
+
+    /**
+     * @brief Render 함수를 재정의했음을 나타냅니다.
+     */
+    static constexpr ComponentHooks RenderHook = 1 << 4;
+
+    /**
+     * @brief 모든 생명주기 함수를 나타냅니다.
+     */
+    static constexpr ComponentHooks AllHooks = StartHook | UpdateHook | FixedUpdateHook | LateUpdateHook | RenderHook;
+
+    /**
+     * @brief Update 함수를 작업 스레드에서 호출해도 안전함을 나타냅니다.
+     */
+    static constexpr ComponentHooks ParallelHook = 1 << 5;
+
+private:
+    /**
+     * @brief 다음에 발급할 컴포넌트 타입 ID. 작업 스레드에서 처음 조회되는 타입도 있으므로 원자적으로 발급합니다.
+     */
+    static inline std::atomic<ComponentTypeID> nextTypeID = 0;
+};
+
+/**
+ * @brief 인턴된 이름의 ID를 정의합니다.
+ */
+using NameID = std::uint32_t;
+
+/**
+ * @class NameRegistry
+ *
+ * @brief 오브젝트의 이름과 태그를 한 번만 저장하고, 조밀한 ID로 참조할 수 있도록 인턴합니다.
+ */
+class NameRegistry final
+{
+    STATIC_CLASS(NameRegistry)
+
+public:
+    /**
+     * @brief 유효하지 않은 ID.
+     */
+    static constexpr NameID InvalidID = std::numeric_limits<NameID>::max();
+
+    /**
+     * @brief 지정한 문자열을 인턴하고 ID를 반환합니다.
+     *
+     * @param name_ 인턴할 문자열
+     *
+     * @return NameID 인턴된 문자열의 ID
+     */
+    static NameID Intern(std::string_view name_) noexcept;
+
+    /**
+     * @brief 이미 인턴된 문자열의 ID를 반환합니다.
+     *
+     * @param name_ 찾을 문자열
+     *
+     * @return NameID 인턴된 문자열의 ID. 인턴되지 않았다면 InvalidID
+     */
+    [[nodiscard]]
+    static NameID Find(std::string_view name_) noexcept;
+
+    /**
+     * @brief 지정한 ID의 문자열을 반환합니다.
+     *
+     * @param id_ 지정할 ID
+     *
+     * @return const std::string& 인턴된 문자열
+     */
+    [[nodiscard]]
+    static inline const std::string& GetString(const NameID id_) noexcept
+    {
+        return names[id_];
+    }
 
+private:
     /**
-     * @brief 해당 오브젝트를 초기화합니다.
+     * @brief 인턴된 문자열들. 주소가 바뀌지 않도록 deque에 보관합니다.
      */
-    void Start() noexcept;
+    static std::deque<std::string> names;
+
+    /**
+     * @brief 문자열에서 ID로의 맵.
+     */
+    static std::unordered_map<std::string_view, NameID> ids;
+};
+
+/**
+ * @class Object
+ *
+ * @brief 오브젝트를 정의합니다.
+ */
+class Object
+{
+    friend class Scene;
 
+public:
     /**
-     * @brief 해당 오브젝트를 매 프레임마다 갱신합니다.
+     * @brief 오브젝트가 속할 수 있는 렌더링 레이어의 개수. 카메라의 컬링 마스크는 레이어마다 한 비트를 사용합니다.
      */
-    void Update() noexcept;
+    static constexpr std::uint8_t LayerCount = 32;
 
     /**
-     * @brief 해당 오브젝트를 고정 프레임마다 갱신합니다.
+     * @brief 생성자.
+     *
+     * @param name_ 생성할 오브젝트의 이름
+     * @param tag_  생성할 오브젝트의 태그
      */
-    void FixedUpdate() noexcept;
+    Object(std::string_view name_ = "New Object", std::string_view tag_ = "Not tag") noexcept;
 
     /**
-     * @brief 해당 오브젝트를 렌더링합니다.
+     * @brief 소멸자.
      */
-    void Render() noexcept;
+    virtual ~Object() noexcept;
 
     /**
      * @brief 해당 오브젝트의 이름을 가져옵니다.
      *
-     * @return String 해당 오브젝트의 이름
+     * @return const std::string& 해당 오브젝트의 이름
      */
     [[nodiscard]]
-    inline std::string GetWindowTitle() const noexcept
+    inline const std::string& GetWindowTitle() const noexcept
+    {
+        return NameRegistry::GetString(name);
+    }
+
+    /**
+     * @brief 해당 오브젝트의 이름 ID를 가져옵니다.
+     *
+     * @return NameID 해당 오브젝트의 이름 ID
+     */
+    [[nodiscard]]
+    inline NameID GetNameID() const noexcept
     {
         return name;
     }
@@ -77,16 +274,27 @@ class Object
      */
     inline void SetName(std::string_view name_) noexcept
     {
-        name = name_;
+        name = NameRegistry::Intern(name_);
     }
 
     /**
      * @brief 해당 오브젝트의 태그를 가져옵니다.
      *
-     * @return String 해당 오브젝트의 태그
+     * @return const std::string& 해당 오브젝트의 태그
+     */
+    [[nodiscard]]
+    inline const std::string& GetTag() const noexcept
+    {
+        return NameRegistry::GetString(tag);
+    }
+
+    /**
+     * @brief 해당 오브젝트의 태그 ID를 가져옵니다.
+     *
+     * @return NameID 해당 오브젝트의 태그 ID
      */
     [[nodiscard]]
-    inline std::string GetTag() const noexcept
+    inline NameID GetTagID() const noexcept
     {
         return tag;
     }
@@ -96,10 +304,7 @@ class Object
      *
      * @param tag_ 지정할 태그
      */
-    inline void SetTag(std::string_view tag_) noexcept
-    {
-        tag = tag_;
-    }
+    void SetTag(std::string_view tag_) noexcept;
 
     /**
      * @brief 해당 오브젝트의 활성화 여부를 반환합니다.
@@ -122,6 +327,45 @@ class Object
         isEnabled = enabled_;
     }
 
+    /**
+     * @brief 해당 오브젝트가 정적 오브젝트인지 여부를 반환합니다.
+     *
+     * @return bool 해당 오브젝트가 정적 오브젝트인지 여부
+     */
+    [[nodiscard]]
+    inline bool IsStatic() const noexcept
+    {
+        return isStatic;
+    }
+
+    /**
+     * @brief 해당 오브젝트가 정적 오브젝트인지 여부를 설정합니다.
+     *
+     * @details 정적 오브젝트는 월드 행렬이 한 번만 계산되고, Update/FixedUpdate/LateUpdate 호출 목록에서 제외되며,
+     *          렌더링 컴포넌트는 미리 묶어 둔 정적 렌더링 버킷에 등록됩니다.
+     *
+     * @param static_ 정적 오브젝트인지 여부
+     */
+    void SetStatic(bool static_) noexcept;
+
+    /**
+     * @brief 해당 오브젝트의 렌더링 레이어를 반환합니다.
+     *
+     * @return std::uint8_t 해당 오브젝트의 렌더링 레이어
+     */
+    [[nodiscard]]
+    inline std::uint8_t GetLayer() const noexcept
+    {
+        return layer;
+    }
+
+    /**
+     * @brief 해당 오브젝트의 렌더링 레이어를 설정합니다. 컬링 마스크에 이 레이어가 포함된 카메라만 해당 오브젝트를 그립니다.
+     *
+     * @param layer_ 설정할 렌더링 레이어 (0부터 LayerCount - 1까지)
+     */
+    void SetLayer(std::uint8_t layer_) noexcept;
+
     /**
      * @brief 해당 오브젝트의 파괴 여부를 반환합니다.
      *
@@ -135,10 +379,19 @@ class Object
 
     /**
      * @brief 해당 오브젝트를 파괴합니다.
+     *        실제 해제는 프레임이 끝날 때 씬에서 한꺼번에 처리됩니다.
+     */
+    void Destroy() noexcept;
+
+    /**
+     * @brief 해당 오브젝트가 속한 씬을 반환합니다.
+     *
+     * @return Scene* 해당 오브젝트가 속한 씬
      */
-    inline void Destroy() noexcept
+    [[nodiscard]]
+    inline Scene* GetScene() const noexcept
     {
-        isDestroyed = true;
+        return scene;
     }
 
     /**
@@ -152,6 +405,17 @@ class Object
         return transform;
     }
 
+    /**
+     * @brief 해당 오브젝트의 핸들 테이블 인덱스를 반환합니다.
+     *
+     * @return std::uint32_t 해당 오브젝트의 핸들 테이블 인덱스
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetHandleIndex() const noexcept
+    {
+        return handleIndex;
+    }
+
     /**
      * @brief 지정한 타입의 컴포넌트가 있는지 여부를 반환합니다.
      *
@@ -162,7 +426,7 @@ class Object
     template <FromComponent TComponent>
     bool HasComponent() const noexcept
     {
-        return GetComponent<TComponent>() != nullptr;
+        return componentMask.test(ComponentRegistry::GetTypeID<TComponent>());
     }
 
     /**
@@ -175,15 +439,27 @@ class Object
     template <FromComponent TComponent>
     TComponent* AddComponent() noexcept
     {
-        if (HasComponent<TComponent>())
+        const ComponentTypeID typeID = ComponentRegistry::GetTypeID<TComponent>();
+        if (typeID >= MaxComponentTypes || componentMask.test(typeID))
         {
             return nullptr;
         }
 
-        std::unique_ptr<TComponent> newComponent = std::make_unique<TComponent>(this);
-        newComponent->Awake();
+        PoolPtr<Component> newComponent = Pool<TComponent>::template Make<Component>(this);
+
+        TComponent* const result = static_cast<TComponent*>(newComponent.get());
+        result->typeID           = typeID;
+        result->hooks            = ComponentRegistry::GetHooks<TComponent>();
+        result->Awake();
+
+        components.emplace_back(std::move(newComponent));
+
+        componentSlots[typeID] = result;
+        componentMask.set(typeID);
+
+        RegisterComponent(result);
 
-        return dynamic_cast<TComponent*>(components.emplace_back(std::move(newComponent)).get());
+        return result;
     }
 
     /**
@@ -212,29 +488,25 @@ class Object
     template <FromComponent TComponent>
     TComponent* GetComponent() const noexcept
     {
-        const std::type_index targetType = std::type_index(typeid(TComponent));
-
-        for (const std::unique_ptr<Component>& component : components)
+        const ComponentTypeID typeID = ComponentRegistry::GetTypeID<TComponent>();
+        if (typeID >= MaxComponentTypes)
         {
-            if (std::type_index(typeid(*component)) == targetType)
-            {
-                return static_cast<TComponent*>(component.get());
-            }
+            return nullptr;
         }
 
-        return nullptr;
+        return static_cast<TComponent*>(componentSlots[typeID]);
     }
 
 protected:
     /**
-     * @brief 해당 오브젝트의 이름.
+     * @brief 해당 오브젝트의 이름 ID.
      */
-    std::string name;
+    NameID name;
 
     /**
-     * @brief 해당 오브젝트의 태그.
+     * @brief 해당 오브젝트의 태그 ID.
      */
-    std::string tag;
+    NameID tag;
 
     /**
      * @brief 해당 오브젝트의 트랜스폼 컴포넌트.
@@ -244,14 +516,73 @@ class Object
     /**
      * @brief 해당 오브젝트에 추가된 컴포넌트들.
      */
-    std::vector<std::unique_ptr<Component>> components;
+    std::vector<PoolPtr<Component>> components;
+
+    /**
+     * @brief 컴포넌트 타입 ID로 색인되는 컴포넌트 슬롯.
+     */
+    std::array<Component*, MaxComponentTypes> componentSlots;
+
+    /**
+     * @brief 해당 오브젝트가 가진 컴포넌트 타입들의 비트마스크.
+     */
+    std::bitset<MaxComponentTypes> componentMask;
 
 private:
+    /**
+     * @brief 해당 오브젝트가 속한 씬에 컴포넌트를 등록합니다.
+     *
+     * @param component_ 등록할 컴포넌트
+     */
+    void RegisterComponent(Component* const component_) noexcept;
+
+    /**
+     * @brief 파괴된 컴포넌트를 해당 오브젝트에서 제거하고 해제합니다.
+     *
+     * @param component_ 제거할 컴포넌트
+     */
+    void ReleaseComponent(Component* const component_) noexcept;
+
+    /**
+     * @brief 해당 오브젝트의 핸들 테이블 인덱스.
+     */
+    std::uint32_t handleIndex;
+
+    /**
+     * @brief 해당 오브젝트가 씬의 오브젝트 목록에서 차지하는 위치.
+     */
+    std::uint32_t sceneIndex;
+
+    /**
+     * @brief 해당 오브젝트가 씬의 태그 색인에서 차지하는 위치.
+     */
+    std::uint32_t tagIndex;
+
+    /**
+     * @brief 해당 오브젝트가 속한 씬.
+     */
+    Scene* scene;
+
+    /**
+     * @brief 해당 오브젝트의 렌더링 레이어.
+     */
+    std::uint8_t layer;
+
+    /**
+     * @brief 해당 오브젝트가 UI 오브젝트인지 여부.
+     */
+    bool isUI;
+
     /**
      * @brief 해당 오브젝트의 활성화 여부.
      */
     bool isEnabled;
 
+    /**
+     * @brief 해당 오브젝트가 정적 오브젝트인지 여부.
+     */
+    bool isStatic;
+
     /**
      * @brief 해당 오브젝트의 파괴 여부.
      */
@@ -266,6 +597,7 @@ class Object
 class Component
 {
     friend class Object;
+    friend class Scene;
 
 public:
     /**
@@ -286,6 +618,14 @@ class Component
         World
     };
 
+    /**
+     * @brief Update를 작업 스레드에서 병렬로 호출해도 안전한지 여부.
+     *        Update에서 자신이 속한 오브젝트 계층 구조만 읽고 쓰며, 오브젝트나 컴포넌트를 생성하거나 파괴하지 않는
+     *        컴포넌트만 true로 다시 선언할 수 있습니다. OpenGL이나 OpenAL을 호출하는 컴포넌트는 메인 스레드에서 갱신되어야 합니다.
+     *        병렬로 갱신되는 컴포넌트들의 Update는 매 프레임 다른 모든 컴포넌트의 Update보다 먼저 호출됩니다.
+     */
+    static constexpr bool IsParallelSafe = false;
+
     /**
      * @brief 생성자.
      *
@@ -320,6 +660,17 @@ class Component
         return owner->GetTransform();
     }
 
+    /**
+     * @brief 해당 컴포넌트의 핸들 테이블 인덱스를 반환합니다.
+     *
+     * @return std::uint32_t 해당 컴포넌트의 핸들 테이블 인덱스
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetHandleIndex() const noexcept
+    {
+        return handleIndex;
+    }
+
     /**
      * @brief 컴포넌트의 활성화 여부를 반환합니다.
      *
@@ -382,11 +733,9 @@ class Component
 
     /**
      * @brief 해당 컴포넌트를 파괴합니다.
+     *        실제 해제는 프레임이 끝날 때 씬에서 한꺼번에 처리됩니다.
      */
-    inline void Destroy() noexcept
-    {
-        isDestroyed = true;
-    }
+    void Destroy() noexcept;
 
 protected:
     /**
@@ -463,6 +812,26 @@ class Component
     Transform* transform;
 
 private:
+    /**
+     * @brief 해당 컴포넌트의 핸들 테이블 인덱스.
+     */
+    std::uint32_t handleIndex;
+
+    /**
+     * @brief 해당 컴포넌트가 씬의 컴포넌트 색인에서 차지하는 위치.
+     */
+    std::uint32_t typeIndex;
+
+    /**
+     * @brief 해당 컴포넌트의 타입 ID.
+     */
+    ComponentTypeID typeID;
+
+    /**
+     * @brief 해당 컴포넌트가 재정의한 생명주기 함수들.
+     */
+    ComponentHooks hooks;
+
     /**
      * @brief 해당 컴포넌트의 활성화 여부.
      */
@@ -479,13 +848,166 @@ class Component
     bool isDestroyed;
 };
 
+/**
+ * @class TransformManager
+ *
+ * @brief 모든 트랜스폼의 위치, 회전, 크기 및 월드 행렬을 SoA(Structure of Arrays) 형태의 연속된 풀에 보관합니다.
+ */
+class TransformManager final
+{
+    friend class Object;
+    friend class Transform;
+
+    STATIC_CLASS(TransformManager)
+
+public:
+    /**
+     * @brief 유효하지 않은 트랜스폼 인덱스.
+     */
+    static constexpr std::uint32_t InvalidIndex = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief 부모가 자식보다 먼저 오도록 정렬된 순서로 변경된 트랜스폼의 월드 행렬을 한 번에 갱신합니다.
+     */
+    static void UpdateWorldMatrices() noexcept;
+
+    /**
+     * @brief 현재 사용 중인 트랜스폼의 개수를 반환합니다.
+     *
+     * @return std::size_t 현재 사용 중인 트랜스폼의 개수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetCount() noexcept
+    {
+        return positions.size() - freeIndices.size();
+    }
+
+private:
+    /**
+     * @brief 새 트랜스폼 슬롯을 할당합니다.
+     *
+     * @return std::uint32_t 할당된 슬롯의 인덱스
+     */
+    [[nodiscard]]
+    static std::uint32_t Allocate() noexcept;
+
+    /**
+     * @brief 지정한 트랜스폼 슬롯을 반환합니다.
+     *
+     * @param index_ 반환할 슬롯의 인덱스
+     */
+    static void Release(std::uint32_t index_) noexcept;
+
+    /**
+     * @brief 지정한 트랜스폼을 정적 트랜스폼으로 설정하거나 해제합니다.
+     *
+     * @details 정적 트랜스폼은 설정할 때 월드 행렬을 한 번 계산한 뒤 매 프레임 갱신에서 제외됩니다.
+     *          이후에 값이 변경되더라도 월드 행렬을 요청할 때 다시 계산됩니다.
+     *
+     * @param index_  지정할 트랜스폼의 인덱스
+     * @param static_ 정적 트랜스폼인지 여부
+     */
+    static void SetStatic(std::uint32_t index_, bool static_) noexcept;
+
+    /**
+     * @brief 부모가 자식보다 먼저 오도록 갱신 순서를 다시 계산합니다.
+     */
+    static void RebuildUpdateOrder() noexcept;
+
+    /**
+     * @brief 지정한 트랜스폼의 로컬/월드 행렬을 필요한 경우에만 다시 계산합니다.
+     *
+     * @param index_ 계산할 트랜스폼의 인덱스
+     */
+    static void Resolve(std::uint32_t index_) noexcept;
+
+    /**
+     * @brief 로컬 행렬을 다시 계산해야 함을 나타내는 플래그.
+     */
+    static constexpr std::uint8_t LocalDirty = 1 << 0;
+
+    /**
+     * @brief 월드 행렬을 다시 계산해야 함을 나타내는 플래그.
+     */
+    static constexpr std::uint8_t WorldDirty = 1 << 1;
+
+    /**
+     * @brief 각 트랜스폼의 로컬 위치 값.
+     */
+    static std::vector<glm::fvec3> positions;
+
+    /**
+     * @brief 각 트랜스폼의 로컬 회전 값.
+     */
+    static std::vector<glm::fquat> rotations;
+
+    /**
+     * @brief 각 트랜스폼의 로컬 크기 값.
+     */
+    static std::vector<glm::fvec3> scales;
+
+    /**
+     * @brief 각 트랜스폼의 캐시된 로컬 행렬.
+     */
+    static std::vector<glm::fmat4x4> localMatrices;
+
+    /**
+     * @brief 각 트랜스폼의 캐시된 월드 행렬.
+     */
+    static std::vector<glm::fmat4x4> worldMatrices;
+
+    /**
+     * @brief 각 트랜스폼의 변경 플래그. (LocalDirty, WorldDirty)
+     */
+    static std::vector<std::uint8_t> dirtyFlags;
+
+    /**
+     * @brief 각 트랜스폼의 월드 행렬이 다시 계산될 때마다 증가하는 버전.
+     */
+    static std::vector<std::uint32_t> versions;
+
+    /**
+     * @brief 각 트랜스폼의 부모 트랜스폼 인덱스.
+     */
+    static std::vector<std::uint32_t> parents;
+
+    /**
+     * @brief 각 슬롯의 사용 여부.
+     */
+    static std::vector<std::uint8_t> isAlive;
+
+    /**
+     * @brief 각 트랜스폼이 정적 트랜스폼인지 여부. 정적 트랜스폼은 갱신 순서에서 제외됩니다.
+     */
+    static std::vector<std::uint8_t> isStatic;
+
+    /**
+     * @brief 재사용할 수 있는 슬롯 인덱스들.
+     */
+    static std::vector<std::uint32_t> freeIndices;
+
+    /**
+     * @brief 부모가 자식보다 먼저 오도록 정렬된 갱신 순서.
+     */
+    static std::vector<std::uint32_t> updateOrder;
+
+    /**
+     * @brief 갱신 순서를 다시 계산해야 하는지 여부.
+     */
+    static bool isOrderDirty;
+};
+
 /**
  * @class Transform
  *
  * @brief 오브젝트의 위치, 회전 및 크기를 정의합니다.
+ *
+ * @details 실제 값은 TransformManager의 풀에 저장되며, 해당 컴포넌트는 풀의 인덱스만 가집니다.
  */
 class Transform : public Component
 {
+    friend class Object;
+
 public:
     /**
      * @brief 생성자.
@@ -507,7 +1029,7 @@ class Transform : public Component
     [[nodiscard]]
     inline const glm::fvec3& GetPosition() const noexcept
     {
-        return position;
+        return TransformManager::positions[index];
     }
 
     /**
@@ -517,7 +1039,8 @@ class Transform : public Component
      */
     inline void SetPosition(const glm::fvec3& position_) noexcept
     {
-        position = position_;
+        TransformManager::positions[index] = position_;
+        MarkLocalDirty();
     }
 
     /**
@@ -526,9 +1049,9 @@ class Transform : public Component
      * @return glm::fvec3 오브젝트의 회전 값
      */
     [[nodiscard]]
-    inline const glm::fvec3& GetRotation() const noexcept
+    inline glm::fvec3 GetRotation() const noexcept
     {
-        return glm::degrees(glm::eulerAngles(rotation));
+        return glm::degrees(glm::eulerAngles(TransformManager::rotations[index]));
     }
 
     /**
@@ -538,7 +1061,8 @@ class Transform : public Component
      */
     inline void SetRotation(const glm::fvec3& rotation_) noexcept
     {
-        rotation = glm::quat(glm::radians(rotation_));
+        TransformManager::rotations[index] = glm::quat(glm::radians(rotation_));
+        MarkLocalDirty();
     }
 
     /**
@@ -549,7 +1073,7 @@ class Transform : public Component
     [[nodiscard]]
     inline const glm::fvec3& GetScale() const noexcept
     {
-        return scale;
+        return TransformManager::scales[index];
     }
 
     /**
@@ -559,7 +1083,8 @@ class Transform : public Component
      */
     inline void SetScale(const glm::fvec3& scale_) noexcept
     {
-        scale = scale_;
+        TransformManager::scales[index] = scale_;
+        MarkLocalDirty();
     }
 
     /**
@@ -578,9 +1103,17 @@ class Transform : public Component
      *
      * @param parent_ 설정할 부모 트랜스폼
      */
-    inline void SetParent(Transform* const parent_) noexcept
+    void SetParent(Transform* const parent_) noexcept;
+
+    /**
+     * @brief 해당 트랜스폼의 자식 트랜스폼들을 반환합니다.
+     *
+     * @return const std::vector<Transform*>& 해당 트랜스폼의 자식 트랜스폼들
+     */
+    [[nodiscard]]
+    inline const std::vector<Transform*>& GetChildren() const noexcept
     {
-        parent = parent_;
+        return children;
     }
 
     /**
@@ -591,7 +1124,7 @@ class Transform : public Component
     [[nodiscard]]
     inline glm::fvec3 GetForward() const noexcept
     {
-        return glm::normalize(rotation * glm::fvec3(0.0f, 0.0f, -1.0f));
+        return glm::normalize(TransformManager::rotations[index] * glm::fvec3(0.0f, 0.0f, -1.0f));
     }
 
     /**
@@ -602,7 +1135,7 @@ class Transform : public Component
     [[nodiscard]]
     inline glm::fvec3 GetUp() const noexcept
     {
-        return glm::normalize(rotation * glm::fvec3(0.0f, 1.0f, 0.0f));
+        return glm::normalize(TransformManager::rotations[index] * glm::fvec3(0.0f, 1.0f, 0.0f));
     }
 
     /**
@@ -613,7 +1146,7 @@ class Transform : public Component
     [[nodiscard]]
     inline glm::fvec3 GetRight() const noexcept
     {
-        return glm::normalize(rotation * glm::fvec3(1.0f, 0.0f, 0.0f));
+        return glm::normalize(TransformManager::rotations[index] * glm::fvec3(1.0f, 0.0f, 0.0f));
     }
 
     /**
@@ -626,7 +1159,7 @@ class Transform : public Component
             return;
         }
 
-        LookAt(position + forward_);
+        LookAt(TransformManager::positions[index] + forward_);
     }
 
     /**
@@ -647,8 +1180,11 @@ class Transform : public Component
             return;
         }
 
+        glm::fquat&     rotation      = TransformManager::rotations[index];
         const glm::quat rotationDelta = glm::rotation(currentUp, targetUp);
         rotation                      = rotationDelta * rotation;
+
+        MarkLocalDirty();
     }
 
     /**
@@ -669,8 +1205,11 @@ class Transform : public Component
             return;
         }
 
+        glm::fquat&     rotation      = TransformManager::rotations[index];
         const glm::quat rotationDelta = glm::rotation(currentRight, targetRight);
         rotation                      = rotationDelta * rotation;
+
+        MarkLocalDirty();
     }
 
     /**
@@ -681,8 +1220,9 @@ class Transform : public Component
      */
     inline void LookAt(const glm::fvec3& target, const glm::fvec3& worldUp = glm::fvec3(0, 1, 0)) noexcept
     {
-        const glm::fvec3 direction = glm::normalize(target - position);
-        rotation                   = glm::quatLookAt(direction, worldUp);
+        const glm::fvec3 direction         = glm::normalize(target - TransformManager::positions[index]);
+        TransformManager::rotations[index] = glm::quatLookAt(direction, worldUp);
+        MarkLocalDirty();
     }
 
     /**
@@ -693,14 +1233,18 @@ class Transform : public Component
      */
     inline void Translate(const glm::fvec3& translation_, const Transform::Space space_) noexcept
     {
+        glm::fvec3& position = TransformManager::positions[index];
+
         if (space_ == Space::Local)
         {
-            position += rotation * translation_;
+            position += TransformManager::rotations[index] * translation_;
         }
         else
         {
             position += translation_;
         }
+
+        MarkLocalDirty();
     }
 
     /**
@@ -711,6 +1255,7 @@ class Transform : public Component
      */
     inline void Rotate(const glm::fvec3& eulerAngles_, Space space_ = Space::Local) noexcept
     {
+        glm::fquat&      rotation      = TransformManager::rotations[index];
         const glm::fquat rotationDelta = glm::fquat(glm::radians(eulerAngles_));
 
         if (space_ == Space::Local)
@@ -721,62 +1266,99 @@ class Transform : public Component
         {
             rotation = rotationDelta * rotation;
         }
+
+        MarkLocalDirty();
     }
 
     /**
      * @brief 로컬 좌표계에서의 변환 행렬을 반환합니다.
      *
+     * @details TransformManager의 배열은 Transform이 추가될 때 재할당될 수 있으므로 참조가 아닌 값으로 반환합니다.
+     *
      * @return glm::fmat4x4 로컬 좌표계에서의 변환 행렬
      */
     [[nodiscard]]
     inline glm::fmat4x4 GetLocalMatrix() const noexcept
     {
-        glm::fmat4x4 model(1.0f);
-        model = glm::translate(model, position);
-        model *= glm::mat4_cast(rotation);
-        model = glm::scale(model, scale);
+        if (TransformManager::dirtyFlags[index] != 0)
+        {
+            TransformManager::Resolve(index);
+        }
 
-        return model;
+        return TransformManager::localMatrices[index];
     }
 
     /**
      * @brief 월드 좌표계에서의 변환 행렬을 반환합니다.
      *
+     * @details 변경된 경우에만 부모부터 차례로 다시 계산하며, 그렇지 않으면 캐시된 값을 반환합니다.
+     *          TransformManager의 배열은 Transform이 추가될 때 재할당될 수 있으므로 참조가 아닌 값으로 반환합니다.
+     *
      * @return glm::fmat4x4 월드 좌표계에서의 변환 행렬
      */
     [[nodiscard]]
     inline glm::fmat4x4 GetWorldMatrix() const noexcept
     {
-        glm::fmat4x4 localMatrix = GetLocalMatrix();
-
-        if (parent != nullptr)
+        if (TransformManager::dirtyFlags[index] != 0)
         {
-            return parent->GetWorldMatrix() * localMatrix;
+            TransformManager::Resolve(index);
         }
-        else
+
+        return TransformManager::worldMatrices[index];
+    }
+
+    /**
+     * @brief 월드 행렬의 버전을 반환합니다.
+     *
+     * @details 월드 행렬이 다시 계산될 때마다 증가하므로, 이전에 저장한 값과 같다면 변경되지 않았음을 의미합니다.
+     *
+     * @return std::uint32_t 월드 행렬의 버전
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetVersion() const noexcept
+    {
+        if (TransformManager::dirtyFlags[index] != 0)
         {
-            return localMatrix;
+            TransformManager::Resolve(index);
         }
+
+        return TransformManager::versions[index];
     }
 
 private:
     /**
-     * @brief 오브젝트의 위치 값.
+     * @brief 로컬 값이 변경되었음을 기록하고, 하위 트랜스폼들의 월드 행렬을 무효화합니다.
      */
-    glm::fvec3 position;
+    inline void MarkLocalDirty() noexcept
+    {
+        std::uint8_t& flags = TransformManager::dirtyFlags[index];
+        if (flags & TransformManager::WorldDirty)
+        {
+            flags |= TransformManager::LocalDirty;
+            return;
+        }
+
+        flags |= TransformManager::LocalDirty;
+        MarkWorldDirty();
+    }
 
     /**
-     * @brief 오브젝트의 회전 값.
+     * @brief 해당 트랜스폼과 모든 하위 트랜스폼의 월드 행렬을 무효화합니다.
      */
-    glm::fquat rotation;
+    void MarkWorldDirty() noexcept;
 
     /**
-     * @brief 오브젝트의 크기 값.
+     * @brief TransformManager 풀 내 해당 트랜스폼의 인덱스.
      */
-    glm::fvec3 scale;
+    std::uint32_t index;
 
     /**
      * @brief 해당 트랜스폼의 부모 트랜스폼.
      */
     Transform* parent;
+
+    /**
+     * @brief 해당 트랜스폼의 자식 트랜스폼들.
+     */
+    std::vector<Transform*> children;
 };
\ No newline at end of file
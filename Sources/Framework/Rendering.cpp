@@ -3,14 +3,97 @@
 #include "Application.h"
 #include "Debug.h"
 #include "Resources.h"
+#include "Scenes.h"
+#include "Time.h"
+
+Frustum Frustum::FromMatrix(const glm::fmat4x4& viewProjection_) noexcept
+{
+    // glm은 열 우선이므로 i번째 행은 각 열의 i번째 원소로 이루어집니다.
+    const auto row = [&viewProjection_](const int index_) {
+        return glm::fvec4(viewProjection_[0][index_], viewProjection_[1][index_], viewProjection_[2][index_], viewProjection_[3][index_]);
+    };
+
+    const glm::fvec4 x = row(0);
+    const glm::fvec4 y = row(1);
+    const glm::fvec4 z = row(2);
+    const glm::fvec4 w = row(3);
+
+    Frustum frustum;
+    frustum.planes[0] = w + x;
+    frustum.planes[1] = w - x;
+    frustum.planes[2] = w + y;
+    frustum.planes[3] = w - y;
+    frustum.planes[4] = w + z;
+    frustum.planes[5] = w - z;
+
+    for (glm::fvec4& plane : frustum.planes)
+    {
+        plane /= glm::length(glm::fvec3(plane));
+    }
+
+    return frustum;
+}
+
+bool Frustum::Intersects(const Bounds& bounds_, const glm::fmat4x4& world_) const noexcept
+{
+    const glm::fvec3 center = glm::fvec3(world_ * glm::fvec4(bounds_.center, 1.0f));
+
+    // 경계 상자의 세 축을 월드 공간으로 옮깁니다. 회전과 비균등 스케일이 모두 반영됩니다.
+    const glm::fvec3 axisX = glm::fvec3(world_[0]) * bounds_.extents.x;
+    const glm::fvec3 axisY = glm::fvec3(world_[1]) * bounds_.extents.y;
+    const glm::fvec3 axisZ = glm::fvec3(world_[2]) * bounds_.extents.z;
+
+    const float scale  = std::max({ glm::length(glm::fvec3(world_[0])), glm::length(glm::fvec3(world_[1])), glm::length(glm::fvec3(world_[2])) });
+    const float radius = bounds_.radius * scale;
+
+    for (const glm::fvec4& plane : planes)
+    {
+        const glm::fvec3 normal   = glm::fvec3(plane);
+        const float      distance = glm::dot(normal, center) + plane.w;
+
+        const float boxRadius = std::abs(glm::dot(normal, axisX)) + std::abs(glm::dot(normal, axisY)) + std::abs(glm::dot(normal, axisZ));
+        if (distance < -std::min(radius, boxRadius))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+ScreenProjection ScreenProjection::FromMatrices(const glm::fmat4x4& projection_, const glm::fmat4x4& view_) noexcept
+{
+    ScreenProjection screenProjection;
+    screenProjection.viewProjection = projection_ * view_;
+    screenProjection.verticalScale  = projection_[1][1];
+
+    return screenProjection;
+}
+
+float ScreenProjection::GetScreenSize(const Bounds& bounds_, const glm::fmat4x4& world_) const noexcept
+{
+    const glm::fvec4 center = viewProjection * (world_ * glm::fvec4(bounds_.center, 1.0f));
+
+    const float scale  = std::max({ glm::length(glm::fvec3(world_[0])), glm::length(glm::fvec3(world_[1])), glm::length(glm::fvec3(world_[2])) });
+    const float radius = bounds_.radius * scale;
+
+    // 원근 투영의 w는 시선 방향 거리이고 직교 투영의 w는 1이므로, 두 투영 모두 w로 나누면 정규화 장치 좌표의 반지름이 됩니다.
+    const float depth = std::max(center.w, std::numeric_limits<float>::epsilon());
+
+    // 정규화 장치 좌표의 화면 높이는 2이므로 반지름이 곧 화면 높이에 대한 지름의 비율입니다.
+    return radius * verticalScale / depth;
+}
 
 Camera::Camera(Object* const owner_) noexcept
     : Component(owner_)
-    , shader(nullptr)
     , projection(Projection::Perspective)
     , fieldOfView(60.0f)
     , clipingPlanes(0.1f, 100.0f)
     , orthoSize(10.0f)
+    , cullingMask(AllLayers)
+    , renderOrder(0)
+    , clearMode(ClearMode::None)
+    , clearColor(0.0f, 0.0f, 0.0f, 1.0f)
 {
     const float windowWidth  = Application::GetWindowWidth();
     const float windowHeight = Application::GetWindowHeight();
@@ -26,24 +109,29 @@ Camera::~Camera()
 
 void Camera::Ready() const noexcept
 {
-    if (!shader)
-    {
-        Logger::Error("Camera: Failed to load default shader.");
-        return;
-    }
-
     glViewport(viewport.x, viewport.y, viewport.width, viewport.height);
 
-    shader->Use();
+    if (clearMode != ClearMode::None)
+    {
+        // 다른 카메라의 결과를 보존하도록 가위 테스트로 뷰포트 안만 지웁니다.
+        GraphicsState::SetScissorTest(true);
+        GraphicsState::SetDepthWrite(true);
+        glScissor(viewport.x, viewport.y, viewport.width, viewport.height);
 
-    const glm::mat4 view = GetViewMatrix();
-    shader->SetUniformMatrix4x4("view", view);
+        if (clearMode == ClearMode::ColorAndDepth)
+        {
+            glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        }
+        else
+        {
+            glClear(GL_DEPTH_BUFFER_BIT);
+        }
 
-    const glm::mat4 projection = GetProjectionMatrix();
-    shader->SetUniformMatrix4x4("projection", projection);
+        GraphicsState::SetScissorTest(false);
+    }
 
-    const glm::fvec3 viewPosition = GetTransform()->GetPosition();
-    shader->SetUniformVector3("viewPos", viewPosition);
+    FrameConstants::SetCamera(this);
 }
 
 glm::fmat4x4 Camera::GetViewMatrix() const noexcept
@@ -89,7 +177,6 @@ glm::fmat4x4 Camera::GetProjectionMatrix() const noexcept
 
 Light::Light(Object* const owner_) noexcept
     : Component(owner_)
-    , shader(nullptr)
     , color(1.0f, 1.0f, 1.0f)
     , intensity(0.5f)
 {
@@ -99,25 +186,84 @@ Light::~Light() noexcept
 {
 }
 
-void Light::Update() noexcept
+void FrameConstants::BeginFrame() noexcept
 {
-    if (!shader)
+    const float width  = static_cast<float>(Application::GetWindowWidth());
+    const float height = static_cast<float>(Application::GetWindowHeight());
+
+    // 씬이 없는 로딩 화면에서도 UI 셰이더가 읽을 수 있도록 카메라와 조명을 비운 상태로 먼저 업로드합니다.
+    data.view             = glm::fmat4x4(1.0f);
+    data.projection       = glm::fmat4x4(1.0f);
+    data.viewProjection   = glm::fmat4x4(1.0f);
+    data.screenProjection = glm::ortho(0.0f, width, height, 0.0f, -1.0f, 1.0f);
+    data.cameraPosition   = glm::fvec4(0.0f);
+    data.time             = glm::fvec4(TimeManager::GetTime(), TimeManager::GetDeltaTime(), TimeManager::GetUnscaledDeltaTime(), 0.0f);
+    data.lightCount       = glm::ivec4(0);
+
+    uploadCount = 0;
+    Upload();
+}
+
+void FrameConstants::SetLights(const std::vector<const Light*>& lights_) noexcept
+{
+    const std::size_t lightCount = std::min(lights_.size(), MaxLightCount);
+    for (std::size_t index = 0; index < lightCount; ++index)
     {
-        Logger::Error("Light: Failed to load default shader.");
-        return;
+        const Light* const light = lights_[index];
+
+        data.lights[index].direction = glm::fvec4(light->GetTransform()->GetForward(), 0.0f);
+        data.lights[index].color     = glm::fvec4(light->GetColor() * light->GetIntensity(), 0.0f);
     }
 
-    shader->Use();
-    shader->SetUniformVector3("lightDir", GetTransform()->GetForward());
-    shader->SetUniformVector3("lightColor", color * intensity);
-    // shader->SetUniformVector3("lightPos", GetTransform()->GetPosition());
+    data.lightCount = glm::ivec4(static_cast<int>(lightCount), 0, 0, 0);
+}
+
+void FrameConstants::SetCamera(const Camera* const camera_) noexcept
+{
+    data.view           = camera_->GetViewMatrix();
+    data.projection     = camera_->GetProjectionMatrix();
+    data.viewProjection = data.projection * data.view;
+    data.cameraPosition = glm::fvec4(camera_->GetTransform()->GetPosition(), 1.0f);
+
+    Upload();
+}
+
+void FrameConstants::Initialize() noexcept
+{
+    glGenBuffers(1, &buffer);
+    GraphicsState::BindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferData(GL_UNIFORM_BUFFER, sizeof(Data), nullptr, GL_DYNAMIC_DRAW);
+
+    // 바인딩 지점은 프로그램과 무관하게 유지되므로 한 번만 연결합니다.
+    glBindBufferBase(GL_UNIFORM_BUFFER, Shader::FrameBlockBinding, buffer);
+}
+
+void FrameConstants::Release() noexcept
+{
+    GraphicsState::DeleteBuffer(buffer);
+}
+
+void FrameConstants::Upload() noexcept
+{
+    GraphicsState::BindBuffer(GL_UNIFORM_BUFFER, buffer);
+    glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Data), &data);
+
+    ++uploadCount;
 }
 
+FrameConstants::Data FrameConstants::data        = {};
+unsigned int         FrameConstants::buffer      = 0;
+std::size_t          FrameConstants::uploadCount = 0;
+
 MeshRenderer::MeshRenderer(Object* const owner_) noexcept
     : Component(owner_)
-    , shader(nullptr)
     , mesh(nullptr)
     , texture(nullptr)
+    , textureLayer(0)
+    , shader(nullptr)
+    , instancedShader(nullptr)
+    , isTransparent(false)
+    , lod(0)
 {
 }
 
@@ -139,20 +285,244 @@ void MeshRenderer::Render() noexcept
         return;
     }
 
-    shader->Use();
-    shader->SetUniformMatrix4x4("model", GetTransform()->GetWorldMatrix());
+    // 실제 드로우 콜은 렌더 큐가 상태별로 정렬한 뒤에 실행합니다.
+    RenderQueue::Submit(RenderQueue::Layer::World, isTransparent, shader, texture, mesh, GetTransform()->GetWorldMatrix(), textureLayer, lod);
+}
 
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, texture->GetTextureID());
+std::uint32_t MeshRenderer::SelectLod(const ScreenProjection& screenProjection_) noexcept
+{
+    const std::uint32_t lodCount = mesh ? mesh->GetLodCount() : 1;
+    if (lodCount <= 1)
+    {
+        lod = 0;
+        return lod;
+    }
 
-    GLint samplerLoc = glGetUniformLocation(shader->GetProgramID(), "outTexture");
-    glUniform1i(samplerLoc, 0);
-    // if (texture)
-    // {
-    //     texture->Bind();
-    // }
-    //
-    // shader->SetUniformInt("outTexture", 0);
+    const float screenSize = screenProjection_.GetScreenSize(mesh->GetBounds(), GetTransform()->GetWorldMatrix());
+
+    // LOD n과 n + 1의 경계는 LodScreenSize / 2^n입니다. 경계를 히스테리시스만큼 더 넘었을 때만 한 단계씩 옮겨 갑니다.
+    const auto threshold = [](const std::uint32_t lod_) {
+        return LodScreenSize / static_cast<float>(1u << lod_);
+    };
+
+    lod = std::min(lod, lodCount - 1);
+    while (lod + 1 < lodCount && screenSize < threshold(lod) * (1.0f - LodHysteresis))
+    {
+        ++lod;
+    }
+    while (lod > 0 && screenSize > threshold(lod - 1) * (1.0f + LodHysteresis))
+    {
+        --lod;
+    }
+
+    return lod;
+}
+
+void MeshRenderer::InvalidateBatch() noexcept
+{
+    // 아직 씬에 추가되지 않았다면 씬에 추가될 때 함께 묶입니다.
+    if (Scene* const scene = GetOwner()->GetScene())
+    {
+        scene->InvalidateRenderBuckets();
+    }
+}
+
+void RenderQueue::Begin(const glm::fmat4x4& view_, const float nearPlane_, const float farPlane_) noexcept
+{
+    view      = view_;
+    nearPlane = nearPlane_;
+    farPlane  = farPlane_;
+
+    packets.clear();
+    matrices.clear();
+    keys.clear();
+}
+
+void RenderQueue::Submit(const Layer         layer_,
+                         const bool          isTransparent_,
+                         Shader* const       shader_,
+                         Texture* const      texture_,
+                         Mesh* const         mesh_,
+                         const glm::fmat4x4& model_,
+                         const std::uint32_t textureLayer_,
+                         const std::uint32_t lod_) noexcept
+{
+    const std::uint32_t matrixIndex = static_cast<std::uint32_t>(matrices.size());
+    matrices.push_back(model_);
+
+    Push(layer_, isTransparent_, ComputeDepth(glm::fvec3(model_[3])), { shader_, texture_, mesh_, nullptr, nullptr, matrixIndex, textureLayer_, 0, 0, 0, lod_ });
+}
+
+void RenderQueue::SubmitInstanced(const Layer         layer_,
+                                  Shader* const       shader_,
+                                  Texture* const      texture_,
+                                  Mesh* const         mesh_,
+                                  const unsigned int  instanceBuffer_,
+                                  const std::uint32_t firstInstance_,
+                                  const std::uint32_t instanceCount_,
+                                  const std::uint32_t lod_) noexcept
+{
+    if (instanceCount_ == 0)
+    {
+        return;
+    }
+
+    // 인스턴스들은 한 번에 그려지므로 깊이는 의미가 없습니다. 가장 가까운 것으로 간주합니다.
+    Push(layer_,
+         false,
+         0.0f,
+         { shader_, texture_, mesh_, nullptr, nullptr, 0, 0, instanceBuffer_, firstInstance_, instanceCount_, lod_ });
+}
+
+void RenderQueue::SubmitCallback(const Layer layer_, const bool isTransparent_, Component* const component_, const Callback callback_) noexcept
+{
+    Push(layer_,
+         isTransparent_,
+         ComputeDepth(component_->GetTransform()->GetPosition()),
+         { nullptr, nullptr, nullptr, component_, callback_, 0, 0, 0, 0, 0, 0 });
+}
+
+float RenderQueue::ComputeDepth(const glm::fvec3& position_) noexcept
+{
+    const float viewDepth = -(view * glm::fvec4(position_, 1.0f)).z;
+    return glm::clamp((viewDepth - nearPlane) / (farPlane - nearPlane), 0.0f, 1.0f);
+}
+
+void RenderQueue::Push(const Layer layer_, const bool isTransparent_, const float depth_, const DrawPacket& packet_) noexcept
+{
+    const auto depthBits = static_cast<std::uint64_t>(depth_ * 65535.0f);
+
+    std::uint64_t key = static_cast<std::uint64_t>(layer_) << 60;
+
+    if (isTransparent_)
+    {
+        // 반투명 패킷은 상태와 관계없이 뒤에서 앞으로, 같은 깊이라면 제출 순서대로 그려야 합니다.
+        const std::uint64_t sequence = std::min<std::uint64_t>(packets.size(), 0xFFFF);
+
+        key |= std::uint64_t(1) << TransparentShift;
+        key |= (0xFFFF - depthBits) << 43;
+        key |= sequence << 27;
+    }
+    else
+    {
+        // GL 객체 이름은 작은 정수로 차례로 발급되므로 하위 비트만으로도 상태를 구분하기에 충분합니다.
+        const std::uint64_t shaderBits  = packet_.shader ? packet_.shader->GetProgramID() & 0x3FF : 0;
+        const std::uint64_t textureBits = packet_.texture ? packet_.texture->GetTextureID() & 0xFFF : 0;
+        const std::uint64_t meshBits    = packet_.mesh ? packet_.mesh->GetVertexArrayID() & 0x3FF : 0;
+
+        key |= shaderBits << 49;
+        key |= textureBits << 37;
+        key |= meshBits << 27;
+        key |= depthBits << 11;
+    }
+
+    keys.emplace_back(key, static_cast<std::uint32_t>(packets.size()));
+    packets.push_back(packet_);
+}
+
+void RenderQueue::Sort() noexcept
+{
+    sortBuffer.resize(keys.size());
+
+    for (std::uint32_t shift = 0; shift < 64; shift += 8)
+    {
+        std::array<std::size_t, 256> offsets{};
+        for (const auto& [key, index] : keys)
+        {
+            ++offsets[(key >> shift) & 0xFF];
+        }
+
+        // 모든 키의 해당 자릿수가 같다면 이번 자릿수는 건너뜁니다.
+        if (offsets[(keys.front().first >> shift) & 0xFF] == keys.size())
+        {
+            continue;
+        }
+
+        std::size_t total = 0;
+        for (std::size_t& offset : offsets)
+        {
+            const std::size_t count = offset;
+            offset                  = total;
+            total += count;
+        }
+
+        for (const auto& entry : keys)
+        {
+            sortBuffer[offsets[(entry.first >> shift) & 0xFF]++] = entry;
+        }
+
+        keys.swap(sortBuffer);
+    }
+}
+
+void RenderQueue::Execute() noexcept
+{
+    if (keys.empty())
+    {
+        return;
+    }
+
+    Sort();
+
+    for (const auto& [key, index] : keys)
+    {
+        const DrawPacket& packet        = packets[index];
+        const bool        isTransparent = ((key >> TransparentShift) & 1) != 0;
+
+        // 직전 패킷과 같은 상태는 GraphicsState가 생략합니다.
+        GraphicsState::SetBlending(isTransparent);
+        if (isTransparent)
+        {
+            GraphicsState::SetBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        }
+
+        if (packet.callback)
+        {
+            packet.callback(packet.component);
+            continue;
+        }
+
+        packet.shader->Use();
+        packet.shader->SetUniformInt("outTexture", 0);
+        if (packet.texture)
+        {
+            packet.texture->Bind();
+        }
+        else
+        {
+            GraphicsState::BindTexture(0, GL_TEXTURE_2D, 0);
+        }
+        packet.mesh->Bind();
+
+        // 양자화된 정점 형식의 위치 복원 값입니다. 셰이더 프로그램은 메쉬 사이에서 공유되므로 매번 설정하되, 값이 같으면 GL 호출은 생략됩니다.
+        packet.shader->SetUniformVector3("positionScale", packet.mesh->GetPositionScale());
+        packet.shader->SetUniformVector3("positionOffset", packet.mesh->GetPositionOffset());
+
+        if (packet.instanceCount > 0)
+        {
+            packet.mesh->IssueInstanced(packet.instanceBuffer, packet.firstInstance, packet.instanceCount, packet.lod);
+        }
+        else
+        {
+            // 인스턴싱이 아니라면 텍스처 배열의 레이어는 유니폼으로 전달합니다.
+            if (packet.texture && packet.texture->GetTarget() == GL_TEXTURE_2D_ARRAY)
+            {
+                packet.shader->SetUniformInt("textureLayer", static_cast<int>(packet.textureLayer));
+            }
+
+            packet.shader->SetUniformMatrix4x4("model", matrices[packet.matrixIndex]);
+            packet.mesh->Issue(packet.lod);
+        }
+    }
+
+    statistics.packetCount += packets.size();
+}
 
-    mesh->Draw();
-}
\ No newline at end of file
+glm::fmat4x4                                         RenderQueue::view      = glm::fmat4x4(1.0f);
+float                                                RenderQueue::nearPlane = 0.0f;
+float                                                RenderQueue::farPlane  = 1.0f;
+std::vector<RenderQueue::DrawPacket>                 RenderQueue::packets;
+std::vector<glm::fmat4x4>                            RenderQueue::matrices;
+std::vector<std::pair<std::uint64_t, std::uint32_t>> RenderQueue::keys;
+std::vector<std::pair<std::uint64_t, std::uint32_t>> RenderQueue::sortBuffer;
+RenderQueueStatistics                                RenderQueue::statistics;
@@ -4,6 +4,85 @@
 #include "Objects.h"
 #include "Resources.h"
 
+/**
+ * @struct Frustum
+ *
+ * @brief 뷰-투영 행렬에서 추출한 여섯 개의 절두체 평면을 정의합니다. 평면의 법선은 절두체 안쪽을 향합니다.
+ */
+struct Frustum final
+{
+    /**
+     * @brief 왼쪽, 오른쪽, 아래쪽, 위쪽, 근평면, 원평면 순서의 평면들. xyz는 단위 법선, w는 원점으로부터의 거리입니다.
+     */
+    glm::fvec4 planes[6];
+
+    /**
+     * @brief 뷰-투영 행렬에서 절두체를 추출합니다. 원근 투영과 직교 투영 모두에 사용할 수 있습니다.
+     *
+     * @param viewProjection_ 투영 행렬 * 뷰 행렬
+     *
+     * @return Frustum 추출한 절두체
+     */
+    [[nodiscard]]
+    static Frustum FromMatrix(const glm::fmat4x4& viewProjection_) noexcept;
+
+    /**
+     * @brief 월드 행렬로 변환한 경계가 절두체와 겹치는지 검사합니다.
+     *
+     * @details 경계 구와 경계 상자 중 더 작은 쪽의 투영 반지름으로 각 평면을 검사하므로,
+     *          보수적으로 판단하여 보이는 오브젝트를 잘못 제외하지 않습니다.
+     *
+     * @param bounds_ 로컬 공간 경계
+     * @param world_  월드 행렬
+     *
+     * @return bool 겹친다면 true
+     */
+    [[nodiscard]]
+    bool Intersects(const Bounds& bounds_, const glm::fmat4x4& world_) const noexcept;
+};
+
+/**
+ * @struct ScreenProjection
+ *
+ * @brief 카메라 패스 하나에서 경계 구가 화면에 투영된 크기를 계산하는 데 필요한 행렬을 정의합니다.
+ */
+struct ScreenProjection final
+{
+    /**
+     * @brief 투영 행렬 * 뷰 행렬.
+     */
+    glm::fmat4x4 viewProjection = glm::fmat4x4(1.0f);
+
+    /**
+     * @brief 투영 행렬의 세로 배율. 원근 투영이라면 1 / tan(시야각 / 2), 직교 투영이라면 2 / 화면 높이입니다.
+     */
+    float verticalScale = 1.0f;
+
+    /**
+     * @brief 투영 행렬과 뷰 행렬로 화면 투영 정보를 만듭니다.
+     *
+     * @param projection_ 투영 행렬
+     * @param view_       뷰 행렬
+     *
+     * @return ScreenProjection 화면 투영 정보
+     */
+    [[nodiscard]]
+    static ScreenProjection FromMatrices(const glm::fmat4x4& projection_, const glm::fmat4x4& view_) noexcept;
+
+    /**
+     * @brief 월드 행렬로 변환한 경계 구의 지름이 화면 높이에서 차지하는 비율을 계산합니다.
+     *
+     * @details 중심이 카메라 뒤나 바로 앞에 있다면 매우 큰 값을 반환합니다.
+     *
+     * @param bounds_ 로컬 공간 경계
+     * @param world_  월드 행렬
+     *
+     * @return float 화면 높이에 대한 비율. 1이라면 화면 높이를 가득 채웁니다.
+     */
+    [[nodiscard]]
+    float GetScreenSize(const Bounds& bounds_, const glm::fmat4x4& world_) const noexcept;
+};
+
 class Camera : public Component
 {
 public:
@@ -23,6 +102,32 @@ class Camera : public Component
         Orthographic
     };
 
+    /**
+     * @brief 렌더링을 시작하기 전 뷰포트 영역을 지우는 방식을 정의합니다.
+     */
+    enum class ClearMode : std::uint8_t
+    {
+        /**
+         * @brief 지우지 않습니다. 프레임 시작 시 화면 전체가 지워지므로 주 카메라에 적합합니다.
+         */
+        None,
+
+        /**
+         * @brief 깊이만 지웁니다. 앞선 카메라의 결과 위에 겹쳐 그릴 때 사용합니다.
+         */
+        Depth,
+
+        /**
+         * @brief 색상과 깊이를 모두 지웁니다. 미니맵처럼 뷰포트 안을 독립적으로 그릴 때 사용합니다.
+         */
+        ColorAndDepth
+    };
+
+    /**
+     * @brief 모든 레이어를 포함하는 컬링 마스크.
+     */
+    static constexpr std::uint32_t AllLayers = 0xFFFFFFFFu;
+
     /**
      * @struct Viewport
      *
@@ -82,21 +187,10 @@ class Camera : public Component
     virtual ~Camera() noexcept override;
 
     /**
-     * @brief 렌더링을 시작하기 전 해당 카메라를 준비합니다.
+     * @brief 렌더링을 시작하기 전 해당 카메라의 뷰포트를 설정하여 지우기 방식에 따라 지우고, 프레임 상수를 갱신합니다.
      */
     void Ready() const noexcept;
 
-    [[nodiscard]]
-    inline Shader* const GetShader() const noexcept
-    {
-        return shader;
-    }
-
-    inline void SetShader(Shader* const shader_) noexcept
-    {
-        shader = shader_;
-    }
-
     /**
      * @brief 해당 카메라의 투영 방식을 반환합니다.
      *
@@ -244,6 +338,103 @@ class Camera : public Component
         orthoSize = orthoSize_;
     }
 
+    /**
+     * @brief 해당 카메라의 컬링 마스크를 반환합니다.
+     *
+     * @return std::uint32_t 해당 카메라가 그리는 레이어들의 비트 마스크
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetCullingMask() const noexcept
+    {
+        return cullingMask;
+    }
+
+    /**
+     * @brief 해당 카메라의 컬링 마스크를 설정합니다. 마스크에 포함되지 않은 레이어의 렌더링 버킷은 순회하지 않습니다.
+     *
+     * @param cullingMask_ 해당 카메라가 그릴 레이어들의 비트 마스크
+     */
+    inline void SetCullingMask(const std::uint32_t cullingMask_) noexcept
+    {
+        cullingMask = cullingMask_;
+    }
+
+    /**
+     * @brief 해당 카메라의 컬링 마스크가 지정한 레이어를 포함하는지 여부를 반환합니다.
+     *
+     * @param layer_ 검사할 레이어
+     *
+     * @return bool 포함 여부
+     */
+    [[nodiscard]]
+    inline bool IsLayerVisible(const std::uint8_t layer_) const noexcept
+    {
+        return (cullingMask >> layer_) & 1u;
+    }
+
+    /**
+     * @brief 해당 카메라의 렌더링 순서를 반환합니다.
+     *
+     * @return int 해당 카메라의 렌더링 순서
+     */
+    [[nodiscard]]
+    inline int GetRenderOrder() const noexcept
+    {
+        return renderOrder;
+    }
+
+    /**
+     * @brief 해당 카메라의 렌더링 순서를 설정합니다. 값이 작은 카메라부터 그리며, 같다면 추가된 순서를 따릅니다.
+     *
+     * @param renderOrder_ 해당 카메라의 렌더링 순서
+     */
+    inline void SetRenderOrder(const int renderOrder_) noexcept
+    {
+        renderOrder = renderOrder_;
+    }
+
+    /**
+     * @brief 해당 카메라의 뷰포트를 지우는 방식을 반환합니다.
+     *
+     * @return ClearMode 해당 카메라의 뷰포트를 지우는 방식
+     */
+    [[nodiscard]]
+    inline ClearMode GetClearMode() const noexcept
+    {
+        return clearMode;
+    }
+
+    /**
+     * @brief 해당 카메라의 뷰포트를 지우는 방식을 설정합니다.
+     *
+     * @param clearMode_ 해당 카메라의 뷰포트를 지우는 방식
+     */
+    inline void SetClearMode(const ClearMode clearMode_) noexcept
+    {
+        clearMode = clearMode_;
+    }
+
+    /**
+     * @brief ClearMode::ColorAndDepth일 때 뷰포트를 지울 색상을 반환합니다.
+     *
+     * @return const glm::fvec4& 뷰포트를 지울 색상
+     */
+    [[nodiscard]]
+    inline const glm::fvec4& GetClearColor() const noexcept
+    {
+        return clearColor;
+    }
+
+    /**
+     * @brief ClearMode::ColorAndDepth일 때 뷰포트를 지울 색상을 설정합니다.
+     *
+     * @param clearColor_ 뷰포트를 지울 색상
+     */
+    inline void SetClearColor(const glm::fvec4& clearColor_) noexcept
+    {
+        clearColor = clearColor_;
+    }
+
     /**
      * @brief 해당 카메라의 뷰 행렬을 반환합니다.
      *
@@ -260,12 +451,29 @@ class Camera : public Component
     [[nodiscard]]
     glm::fmat4x4 GetProjectionMatrix() const noexcept;
 
-private:
     /**
-     * @brief 해당 카메라가 사용할 셰이더.
+     * @brief 해당 카메라의 월드 공간 절두체를 반환합니다.
+     *
+     * @return Frustum 해당 카메라의 절두체
      */
-    Shader* shader;
+    [[nodiscard]]
+    inline Frustum GetFrustum() const noexcept
+    {
+        return Frustum::FromMatrix(GetProjectionMatrix() * GetViewMatrix());
+    }
 
+    /**
+     * @brief LOD 선택에 사용할 해당 카메라의 화면 투영 정보를 반환합니다.
+     *
+     * @return ScreenProjection 해당 카메라의 화면 투영 정보
+     */
+    [[nodiscard]]
+    inline ScreenProjection GetScreenProjection() const noexcept
+    {
+        return ScreenProjection::FromMatrices(GetProjectionMatrix(), GetViewMatrix());
+    }
+
+private:
     /**
      * @brief 해당 카메라의 투영 방식.
      */
@@ -290,6 +498,26 @@ class Camera : public Component
      * @brief 해당 카메라의 직교 투영의 크기.
      */
     float orthoSize;
+
+    /**
+     * @brief 해당 카메라가 그리는 레이어들의 비트 마스크.
+     */
+    std::uint32_t cullingMask;
+
+    /**
+     * @brief 해당 카메라의 렌더링 순서.
+     */
+    int renderOrder;
+
+    /**
+     * @brief 해당 카메라의 뷰포트를 지우는 방식.
+     */
+    Camera::ClearMode clearMode;
+
+    /**
+     * @brief 해당 카메라의 뷰포트를 지울 색상.
+     */
+    glm::fvec4 clearColor;
 };
 
 /**
@@ -310,27 +538,6 @@ class Light : public Component
      */
     virtual ~Light() noexcept override;
 
-    /**
-     * @brief 해당 조명의 셰이더를 반환합니다.
-     *
-     * @return Shader* 조명의 셰이더
-     */
-    [[nodiscard]]
-    inline Shader* const GetShader() const
-    {
-        return shader;
-    }
-
-    /**
-     * @brief 해당 조명의 셰이더를 설정합니다.
-     *
-     * @param shader_ 설정할 셰이더
-     */
-    inline void SetShader(Shader* const shader_)
-    {
-        shader = shader_;
-    }
-
     /**
      * @brief 해당 조명의 색상을 반환합니다.
      * * @return glm::fvec3 조명의 색상
@@ -371,27 +578,137 @@ class Light : public Component
         intensity = intensity_;
     }
 
-protected:
+private:
     /**
-     * @brief 매 프레임마다 호출됩니다.
+     * @brief 해당 조명의 색상.
      */
-    virtual void Update() noexcept override;
+    glm::fvec3 color;
+
+    /**
+     * @brief 해당 조명의 세기.
+     */
+    float intensity;
+};
+
+/**
+ * @class FrameConstants
+ *
+ * @brief 모든 셰이더가 공유하는 프레임 상수를 std140 유니폼 버퍼 하나로 관리합니다.
+ *
+ * @details 버퍼는 Shader::FrameBlockBinding 바인딩 지점에 한 번 연결되며, 셰이더는 FrameConstants 블록을 선언하는 것만으로
+ *          카메라와 조명 정보를 읽을 수 있습니다. 따라서 셰이더나 카메라가 늘어나도 업로드 횟수는 카메라 패스 수만큼만 늘어납니다.
+ */
+class FrameConstants final
+{
+    friend class Application;
+
+    STATIC_CLASS(FrameConstants)
+
+public:
+    /**
+     * @brief 블록에 담을 수 있는 최대 조명 개수. 셰이더의 FrameConstants 블록과 같아야 합니다.
+     */
+    static constexpr std::size_t MaxLightCount = 4;
+
+    /**
+     * @brief 프레임을 시작하며 시간과 화면 투영 행렬을 갱신하고, 카메라와 조명을 비운 상태로 업로드합니다.
+     */
+    static void BeginFrame() noexcept;
+
+    /**
+     * @brief 조명 목록을 설정합니다. MaxLightCount를 넘는 조명은 무시됩니다. 다음 SetCamera에서 함께 업로드됩니다.
+     *
+     * @param lights_ 설정할 조명들
+     */
+    static void SetLights(const std::vector<const Light*>& lights_) noexcept;
+
+    /**
+     * @brief 카메라의 뷰, 투영 행렬과 위치를 설정하고 버퍼에 업로드합니다. 카메라 패스마다 한 번 호출됩니다.
+     *
+     * @param camera_ 렌더링할 카메라
+     */
+    static void SetCamera(const Camera* const camera_) noexcept;
+
+    /**
+     * @brief 이번 프레임에 버퍼를 업로드한 횟수를 반환합니다.
+     *
+     * @return std::size_t 업로드 횟수
+     */
+    [[nodiscard]]
+    static inline std::size_t GetUploadCount() noexcept
+    {
+        return uploadCount;
+    }
 
 private:
     /**
-     * @brief 해당 조명이 사용할 셰이더.
+     * @struct LightData
+     *
+     * @brief std140 규칙을 따르는 조명 하나의 데이터를 정의합니다.
      */
-    Shader* shader;
+    struct LightData
+    {
+        /**
+         * @brief 조명의 방향. w는 사용하지 않습니다.
+         */
+        glm::fvec4 direction;
+
+        /**
+         * @brief 세기가 곱해진 조명의 색상. w는 사용하지 않습니다.
+         */
+        glm::fvec4 color;
+    };
 
     /**
-     * @brief 해당 조명의 색상.
+     * @struct Data
+     *
+     * @brief 셰이더의 FrameConstants 블록과 같은 std140 배치를 가지는 프레임 상수를 정의합니다.
      */
-    glm::fvec3 color;
+    struct Data
+    {
+        glm::fmat4x4 view;
+        glm::fmat4x4 projection;
+        glm::fmat4x4 viewProjection;
+        glm::fmat4x4 screenProjection;
+        glm::fvec4   cameraPosition;
+        glm::fvec4   time;
+        glm::ivec4   lightCount;
+        LightData    lights[MaxLightCount];
+    };
+
+    static_assert(offsetof(Data, cameraPosition) == 256, "FrameConstants must follow the std140 layout.");
+    static_assert(offsetof(Data, lights) == 304, "FrameConstants must follow the std140 layout.");
+    static_assert(sizeof(Data) == 304 + 32 * MaxLightCount, "FrameConstants must follow the std140 layout.");
 
     /**
-     * @brief 해당 조명의 세기.
+     * @brief 유니폼 버퍼를 생성하고 바인딩 지점에 연결합니다.
      */
-    float intensity;
+    static void Initialize() noexcept;
+
+    /**
+     * @brief 유니폼 버퍼를 해제합니다.
+     */
+    static void Release() noexcept;
+
+    /**
+     * @brief 현재 데이터를 버퍼에 업로드합니다.
+     */
+    static void Upload() noexcept;
+
+    /**
+     * @brief 업로드할 프레임 상수.
+     */
+    static Data data;
+
+    /**
+     * @brief 유니폼 버퍼의 ID.
+     */
+    static unsigned int buffer;
+
+    /**
+     * @brief 이번 프레임에 버퍼를 업로드한 횟수.
+     */
+    static std::size_t uploadCount;
 };
 
 /**
@@ -415,10 +732,43 @@ class MeshRenderer : public Component
     virtual ~MeshRenderer() noexcept override;
 
     /**
-     * @brief 해당 메쉬를 렌더링합니다.
+     * @brief LOD 0을 그리는 최소 화면 크기. LOD가 하나 거칠어질 때마다 절반이 됩니다.
+     */
+    static constexpr float LodScreenSize = 0.25f;
+
+    /**
+     * @brief LOD 경계에서 깜빡이지 않도록 LOD를 바꾸기 전에 화면 크기가 경계를 넘어야 하는 비율.
+     */
+    static constexpr float LodHysteresis = 0.1f;
+
+    /**
+     * @brief 마지막으로 선택한 LOD로 해당 메쉬를 렌더링합니다.
      */
     virtual void Render() noexcept override;
 
+    /**
+     * @brief 카메라에 투영된 경계 구의 화면 크기로 그릴 LOD를 고릅니다. 씬이 카메라 패스마다 그리기 전에 호출합니다.
+     *
+     * @details 화면 크기가 LodScreenSize / 2^n보다 작으면 LOD n + 1을 그립니다.
+     *          현재 LOD에서 벗어나려면 경계를 LodHysteresis 비율 이상 넘어야 하므로, 경계 근처에서 LOD가 매 프레임 바뀌지 않습니다.
+     *
+     * @param screenProjection_ 현재 카메라의 화면 투영 정보
+     *
+     * @return std::uint32_t 고른 LOD
+     */
+    std::uint32_t SelectLod(const ScreenProjection& screenProjection_) noexcept;
+
+    /**
+     * @brief 마지막으로 선택한 LOD를 반환합니다.
+     *
+     * @return std::uint32_t 마지막으로 선택한 LOD
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetLod() const noexcept
+    {
+        return lod;
+    }
+
     /**
      * @brief 해당 렌더러가 그릴 메쉬를 설정합니다.
      *
@@ -438,6 +788,8 @@ class MeshRenderer : public Component
     inline void SetMesh(Mesh* const mesh_) noexcept
     {
         mesh = mesh_;
+        lod  = 0;
+        InvalidateBatch();
     }
 
     /**
@@ -459,6 +811,30 @@ class MeshRenderer : public Component
     inline void SetTexture(Texture* const texture_) noexcept
     {
         texture = texture_;
+        InvalidateBatch();
+    }
+
+    /**
+     * @brief 텍스처가 TextureArray일 때 사용할 레이어를 반환합니다.
+     *
+     * @return std::uint32_t 사용할 레이어
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetTextureLayer() const noexcept
+    {
+        return textureLayer;
+    }
+
+    /**
+     * @brief 텍스처가 TextureArray일 때 사용할 레이어를 설정합니다.
+     *
+     * @details 레이어는 같은 텍스처 배열을 쓰는 렌더러들을 나누지 않으므로, 레이어가 달라도 하나의 버킷으로 묶여 인스턴싱됩니다.
+     *
+     * @param textureLayer_ 사용할 레이어
+     */
+    inline void SetTextureLayer(const std::uint32_t textureLayer_) noexcept
+    {
+        textureLayer = textureLayer_;
     }
 
     /**
@@ -480,9 +856,64 @@ class MeshRenderer : public Component
     inline void SetShader(Shader* const shader_) noexcept
     {
         shader = shader_;
+        InvalidateBatch();
+    }
+
+    /**
+     * @brief 해당 렌더러가 인스턴싱으로 그려질 때 사용할 셰이더를 반환합니다.
+     *
+     * @return Shader* 인스턴싱용 셰이더. nullptr이라면 인스턴싱을 사용하지 않습니다.
+     */
+    [[nodiscard]]
+    inline Shader* const GetInstancedShader() const noexcept
+    {
+        return instancedShader;
+    }
+
+    /**
+     * @brief 해당 렌더러가 인스턴싱으로 그려질 때 사용할 셰이더를 설정합니다.
+     *
+     * @details 같은 셰이더, 텍스처, 메쉬를 사용하는 렌더러들은 씬에서 하나의 드로우 콜로 묶여 그려집니다.
+     *          셰이더는 모델 행렬을 유니폼 대신 인스턴스 속성(Mesh::InstanceAttribute)에서 읽어야 합니다.
+     *
+     * @param instancedShader_ 인스턴싱용 셰이더
+     */
+    inline void SetInstancedShader(Shader* const instancedShader_) noexcept
+    {
+        instancedShader = instancedShader_;
+        InvalidateBatch();
+    }
+
+    /**
+     * @brief 해당 렌더러가 반투명한지 여부를 반환합니다.
+     *
+     * @return bool 해당 렌더러가 반투명한지 여부
+     */
+    [[nodiscard]]
+    inline bool IsTransparent() const noexcept
+    {
+        return isTransparent;
+    }
+
+    /**
+     * @brief 해당 렌더러가 반투명한지 여부를 설정합니다.
+     *
+     * @details 반투명한 렌더러는 알파 블렌딩을 사용하며, 인스턴싱에서 제외되어 뒤에서 앞으로 정렬되어 그려집니다.
+     *
+     * @param isTransparent_ 반투명한지 여부
+     */
+    inline void SetTransparent(const bool isTransparent_) noexcept
+    {
+        isTransparent = isTransparent_;
+        InvalidateBatch();
     }
 
 private:
+    /**
+     * @brief 씬에 렌더링 버킷을 다시 묶어야 함을 알립니다.
+     */
+    void InvalidateBatch() noexcept;
+
     /**
      * @brief 해당 렌더러가 그릴 메쉬.
      */
@@ -493,8 +924,254 @@ class MeshRenderer : public Component
      */
     Texture* texture;
 
+    /**
+     * @brief 텍스처가 TextureArray일 때 사용할 레이어.
+     */
+    std::uint32_t textureLayer;
+
     /**
      * @brief 해당 렌더러가 사용할 셰이더.
      */
     Shader* shader;
-};
\ No newline at end of file
+
+    /**
+     * @brief 해당 렌더러가 인스턴싱으로 그려질 때 사용할 셰이더.
+     */
+    Shader* instancedShader;
+
+    /**
+     * @brief 해당 렌더러가 반투명한지 여부.
+     */
+    bool isTransparent;
+
+    /**
+     * @brief 마지막으로 선택한 LOD. 다음 선택의 히스테리시스 기준이 됩니다.
+     */
+    std::uint32_t lod;
+};
+/**
+ * @struct RenderQueueStatistics
+ *
+ * @brief 렌더 큐의 통계를 정의합니다. 상태 변경 통계는 GraphicsState가 집계합니다.
+ */
+struct RenderQueueStatistics
+{
+    /**
+     * @brief 제출된 드로우 패킷의 개수.
+     */
+    std::size_t packetCount = 0;
+};
+
+/**
+ * @class RenderQueue
+ *
+ * @brief 렌더러들이 제출한 드로우 패킷을 64비트 정렬 키로 기수 정렬한 뒤, GraphicsState를 통해 중복된 상태 변경을 건너뛰며 실행합니다.
+ *
+ * @details 정렬 키는 상위 비트부터 다음과 같이 구성됩니다.
+ *          - 불투명: [레이어 4][반투명 0][셰이더 10][텍스처 12][메쉬 10][깊이 16][미사용 11]
+ *          - 반투명: [레이어 4][반투명 1][반전된 깊이 16][제출 순서 16][미사용 27]
+ *          따라서 불투명 패킷은 상태별로 묶인 뒤 앞에서 뒤로, 반투명 패킷은 뒤에서 앞으로 그려지며
+ *          깊이가 같은 반투명 패킷은 제출된 순서를 유지합니다.
+ */
+class RenderQueue final
+{
+    STATIC_CLASS(RenderQueue)
+
+public:
+    /**
+     * @brief 정렬 키의 최상위에 위치하여 먼저 그려질 묶음을 결정하는 레이어를 정의합니다.
+     */
+    enum class Layer : std::uint8_t
+    {
+        /**
+         * @brief 카메라로 보는 게임 오브젝트.
+         */
+        World,
+
+        /**
+         * @brief 화면 좌표계의 UI 오브젝트.
+         */
+        UI
+    };
+
+    /**
+     * @brief 패킷을 실행할 때 호출되는 사용자 정의 드로우 함수를 정의합니다.
+     */
+    using Callback = void (*)(Component* const);
+
+    /**
+     * @brief 새 패스를 시작하고 이전 패킷들을 비웁니다.
+     *
+     * @param view_      깊이를 계산할 뷰 행렬
+     * @param nearPlane_ 깊이 0에 해당하는 거리
+     * @param farPlane_  깊이 1에 해당하는 거리
+     */
+    static void Begin(const glm::fmat4x4& view_, float nearPlane_, float farPlane_) noexcept;
+
+    /**
+     * @brief 메쉬 하나를 그리는 패킷을 제출합니다. 모델 행렬은 셰이더의 model 유니폼으로 전달됩니다.
+     *
+     * @param layer_         패킷의 레이어
+     * @param isTransparent_ 반투명 여부
+     * @param shader_        사용할 셰이더
+     * @param texture_       사용할 텍스처
+     * @param mesh_          그릴 메쉬
+     * @param model_         모델 행렬
+     * @param textureLayer_  텍스처가 TextureArray일 때 textureLayer 유니폼으로 전달할 레이어
+     * @param lod_           그릴 메쉬의 LOD
+     */
+    static void Submit(Layer               layer_,
+                       bool                isTransparent_,
+                       Shader* const       shader_,
+                       Texture* const      texture_,
+                       Mesh* const         mesh_,
+                       const glm::fmat4x4& model_,
+                       std::uint32_t       textureLayer_ = 0,
+                       std::uint32_t       lod_          = 0) noexcept;
+
+    /**
+     * @brief 인스턴스 버퍼의 모델 행렬들로 메쉬를 여러 개 그리는 불투명 패킷을 제출합니다.
+     *
+     * @param layer_          패킷의 레이어
+     * @param shader_         사용할 인스턴싱용 셰이더
+     * @param texture_        사용할 텍스처
+     * @param mesh_           그릴 메쉬
+     * @param instanceBuffer_ 인스턴스별 데이터(Mesh::InstanceData)가 담긴 버퍼
+     * @param firstInstance_  버퍼에서 처음으로 사용할 인스턴스의 위치
+     * @param instanceCount_  그릴 인스턴스의 개수
+     * @param lod_            그릴 메쉬의 LOD
+     */
+    static void SubmitInstanced(Layer          layer_,
+                                Shader* const  shader_,
+                                Texture* const texture_,
+                                Mesh* const    mesh_,
+                                unsigned int   instanceBuffer_,
+                                std::uint32_t  firstInstance_,
+                                std::uint32_t  instanceCount_,
+                                std::uint32_t  lod_ = 0) noexcept;
+
+    /**
+     * @brief 사용자 정의 드로우 함수를 실행하는 패킷을 제출합니다.
+     *
+     * @param layer_         패킷의 레이어
+     * @param isTransparent_ 반투명 여부
+     * @param component_     드로우 함수에 전달할 컴포넌트. 깊이는 컴포넌트의 위치로 계산합니다.
+     * @param callback_      실행할 드로우 함수
+     */
+    static void SubmitCallback(Layer layer_, bool isTransparent_, Component* const component_, Callback callback_) noexcept;
+
+    /**
+     * @brief 제출된 패킷들을 정렬 키 순으로 실행합니다.
+     */
+    static void Execute() noexcept;
+
+    /**
+     * @brief 지난 초기화 이후의 렌더 큐 통계를 반환합니다.
+     *
+     * @return const RenderQueueStatistics& 렌더 큐 통계
+     */
+    [[nodiscard]]
+    static inline const RenderQueueStatistics& GetStatistics() noexcept
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief 렌더 큐 통계를 초기화합니다. 매 프레임 시작 시 호출됩니다.
+     */
+    static inline void ResetStatistics() noexcept
+    {
+        statistics = RenderQueueStatistics();
+    }
+
+private:
+    /**
+     * @struct DrawPacket
+     *
+     * @brief 드로우 콜 하나를 실행하는 데 필요한 정보를 정의합니다.
+     */
+    struct DrawPacket
+    {
+        Shader*       shader;
+        Texture*      texture;
+        Mesh*         mesh;
+        Component*    component;
+        Callback      callback;
+        std::uint32_t matrixIndex;
+        std::uint32_t textureLayer;
+        unsigned int  instanceBuffer;
+        std::uint32_t firstInstance;
+        std::uint32_t instanceCount;
+        std::uint32_t lod;
+    };
+
+    /**
+     * @brief 지정한 위치의 깊이를 Begin에서 지정한 범위 내의 [0, 1] 값으로 계산합니다.
+     *
+     * @param position_ 깊이를 계산할 위치
+     *
+     * @return float 0이 가장 가까운 깊이
+     */
+    [[nodiscard]]
+    static float ComputeDepth(const glm::fvec3& position_) noexcept;
+
+    /**
+     * @brief 정렬 키를 만들어 패킷을 추가합니다.
+     *
+     * @param layer_         패킷의 레이어
+     * @param isTransparent_ 반투명 여부
+     * @param depth_         [0, 1] 범위의 깊이
+     * @param packet_        추가할 패킷
+     */
+    static void Push(Layer layer_, bool isTransparent_, float depth_, const DrawPacket& packet_) noexcept;
+
+    /**
+     * @brief 정렬 키를 8비트씩 나누어 기수 정렬합니다.
+     */
+    static void Sort() noexcept;
+
+    /**
+     * @brief 정렬 키에서 반투명 여부를 나타내는 비트의 위치.
+     */
+    static constexpr std::uint32_t TransparentShift = 59;
+
+    /**
+     * @brief 깊이를 계산할 뷰 행렬.
+     */
+    static glm::fmat4x4 view;
+
+    /**
+     * @brief 깊이 0에 해당하는 거리.
+     */
+    static float nearPlane;
+
+    /**
+     * @brief 깊이 1에 해당하는 거리.
+     */
+    static float farPlane;
+
+    /**
+     * @brief 제출된 패킷들.
+     */
+    static std::vector<DrawPacket> packets;
+
+    /**
+     * @brief 제출된 패킷들의 모델 행렬들.
+     */
+    static std::vector<glm::fmat4x4> matrices;
+
+    /**
+     * @brief 정렬 키와 패킷 인덱스의 쌍들.
+     */
+    static std::vector<std::pair<std::uint64_t, std::uint32_t>> keys;
+
+    /**
+     * @brief 기수 정렬에 사용하는 임시 버퍼.
+     */
+    static std::vector<std::pair<std::uint64_t, std::uint32_t>> sortBuffer;
+
+    /**
+     * @brief 상태 변경 통계.
+     */
+    static RenderQueueStatistics statistics;
+};
@@ -1,5 +1,8 @@
 #include "Resources.h"
 
+#include <cmath>
+#include <numeric>
+
 #include <AL/al.h>
 #include <AL/alc.h>
 
@@ -9,6 +12,9 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 
+#define STB_IMAGE_RESIZE_IMPLEMENTATION
+#include <stb_image_resize2.h>
+
 #define DR_MP3_IMPLEMENTATION
 #include <dr_mp3.h>
 
@@ -30,24 +36,22 @@ Resource::~Resource() noexcept
 
 #pragma region Texture Implementation
 Texture::Texture() noexcept
-    : width(0)
+    : target(GL_TEXTURE_2D)
+    , textureID(0)
+    , width(0)
     , height(0)
     , channels(0)
-    , textureID(0)
 {
 }
 
 Texture::~Texture() noexcept
 {
-    if (textureID)
-    {
-        glDeleteTextures(1, &textureID);
-    }
+    GraphicsState::DeleteTexture(textureID);
 }
 
 void Texture::Bind() const
 {
-    glBindTexture(GL_TEXTURE_2D, textureID);
+    GraphicsState::BindTexture(0, target, textureID);
 }
 
 bool Texture::Load(const std::filesystem::path& path_) noexcept
@@ -80,7 +84,7 @@ bool Texture::Load(const std::filesystem::path& path_) noexcept
     }
 
     glGenTextures(1, &textureID);
-    glBindTexture(GL_TEXTURE_2D, textureID);
+    GraphicsState::BindTexture(0, GL_TEXTURE_2D, textureID);
 
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
@@ -91,13 +95,31 @@ bool Texture::Load(const std::filesystem::path& path_) noexcept
     glGenerateMipmap(GL_TEXTURE_2D);
 
     stbi_image_free(data);
-    glBindTexture(GL_TEXTURE_2D, 0);
 
     Logger::Info("Texture loaded successfully: {} ({}x{}, {}ch)", path_.string(), width, height, channels);
     return true;
 }
 #pragma endregion
 
+#pragma region TextureArray Implementation
+TextureArray::TextureArray() noexcept
+{
+    target = GL_TEXTURE_2D_ARRAY;
+}
+
+std::uint32_t TextureArray::FindLayer(const std::filesystem::path& path_) const noexcept
+{
+    const auto it = std::find(layers.begin(), layers.end(), path_.string());
+    return it == layers.end() ? InvalidLayer : static_cast<std::uint32_t>(it - layers.begin());
+}
+
+bool TextureArray::Load(const std::filesystem::path& path_) noexcept
+{
+    Logger::Error("TextureArray cannot be loaded from a file, build it with TextureArrayBuilder: {}", path_.string());
+    return false;
+}
+#pragma endregion
+
 #pragma region Shader Implementation
 Shader::Shader() noexcept
     : programID(0)
@@ -106,10 +128,7 @@ Shader::Shader() noexcept
 
 Shader::~Shader() noexcept
 {
-    if (programID)
-    {
-        glDeleteProgram(programID);
-    }
+    GraphicsState::DeleteProgram(programID);
 }
 
 bool Shader::Load(const std::filesystem::path& path_) noexcept
@@ -154,18 +173,70 @@ bool Shader::Load(const std::filesystem::path& path_) noexcept
         char infoLog[1024];
         glGetProgramInfoLog(programID, 1024, nullptr, infoLog);
         Logger::Error("Shader Linking Failed [{}]:\n{}", path_.string(), infoLog);
-        glDeleteProgram(programID);
-        programID = 0;
+        GraphicsState::DeleteProgram(programID);
         return false;
     }
 
     glDeleteShader(vertexShader);
     glDeleteShader(fragmentShader);
 
-    Logger::Info("Shader loaded successfully: {}", path_.string());
+    Reflect();
+
+    Logger::Info("Shader loaded successfully: {} ({} uniforms)", path_.string(), uniforms.size());
     return true;
 }
 
+void Shader::Reflect() noexcept
+{
+    uniforms.clear();
+
+    GLint uniformCount = 0;
+    glGetProgramiv(programID, GL_ACTIVE_UNIFORMS, &uniformCount);
+
+    GLint maxNameLength = 0;
+    glGetProgramiv(programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+    std::string name(std::max(maxNameLength, 1), '\0');
+    uniforms.reserve(uniformCount);
+
+    for (GLint index = 0; index < uniformCount; ++index)
+    {
+        GLsizei length = 0;
+        GLint   count  = 0;
+        GLenum  type   = 0;
+        glGetActiveUniform(programID, index, maxNameLength, &length, &count, &type, name.data());
+
+        // 유니폼 블록의 멤버는 위치가 없으므로 테이블에 넣지 않습니다.
+        const GLint location = glGetUniformLocation(programID, name.c_str());
+        if (location < 0)
+        {
+            continue;
+        }
+
+        // 배열은 "name[0]"으로 조회되므로 첫 원소 접미사를 떼어 이름만으로 찾을 수 있게 합니다.
+        std::string_view uniformName(name.data(), length);
+        if (uniformName.ends_with("[0]"))
+        {
+            uniformName.remove_suffix(3);
+        }
+
+        const std::uint32_t hash = UniformName::Hash(uniformName);
+        if (FindUniform(hash) != InvalidUniform)
+        {
+            Logger::Warn("Uniform name hash collision in shader {}: {}", GetPath().string(), uniformName);
+        }
+
+        uniforms.push_back({ hash, location, type, count, false, {} });
+    }
+
+    // 프레임 상수 블록을 선언한 셰이더는 공유 유니폼 버퍼의 바인딩 지점에 연결합니다.
+    const GLuint frameBlockIndex = glGetUniformBlockIndex(programID, "FrameConstants");
+    if (frameBlockIndex != GL_INVALID_INDEX)
+    {
+        glUniformBlockBinding(programID, frameBlockIndex, FrameBlockBinding);
+    }
+}
+
 unsigned int Shader::Compile(unsigned int type_, std::string_view source_) noexcept
 {
     const unsigned int shader     = glCreateShader(type_);
@@ -188,10 +259,121 @@ unsigned int Shader::Compile(unsigned int type_, std::string_view source_) noexc
 #pragma endregion
 
 #pragma region Mesh Implementation
+namespace
+{
+    /**
+     * @brief 법선을 GL_INT_2_10_10_10_REV(정규화) 형식으로 묶습니다.
+     */
+    std::uint32_t PackNormal(const glm::vec3& normal_) noexcept
+    {
+        return glm::packSnorm3x10_1x2(glm::vec4(glm::clamp(normal_, -1.0f, 1.0f), 0.0f));
+    }
+
+    Mesh::PackedVertex EncodePackedVertex(const Mesh::Vertex& vertex_) noexcept
+    {
+        return Mesh::PackedVertex{vertex_.position, PackNormal(vertex_.normal), glm::packHalf2x16(vertex_.texCoords)};
+    }
+
+    Mesh::QuantizedVertex EncodeQuantizedVertex(const Mesh::Vertex& vertex_, const glm::vec3& offset_, const glm::vec3& scale_) noexcept
+    {
+        Mesh::QuantizedVertex result{};
+        for (int axis = 0; axis < 3; ++axis)
+        {
+            // 크기가 0인 축은 모두 최소점에 있으므로 0으로 저장합니다.
+            const float t         = scale_[axis] > 0.0f ? (vertex_.position[axis] - offset_[axis]) / scale_[axis] : 0.0f;
+            result.position[axis] = static_cast<std::uint16_t>(std::lround(std::clamp(t, 0.0f, 1.0f) * 65535.0f));
+        }
+        result.normal    = PackNormal(vertex_.normal);
+        result.texCoords = glm::packHalf2x16(vertex_.texCoords);
+        return result;
+    }
+
+#if defined(DEBUG) || defined(_DEBUG)
+    glm::vec3 UnpackNormal(const std::uint32_t normal_) noexcept
+    {
+        return glm::vec3(glm::unpackSnorm3x10_1x2(normal_));
+    }
+
+    Mesh::Vertex DecodePackedVertex(const Mesh::PackedVertex& vertex_) noexcept
+    {
+        return Mesh::Vertex{vertex_.position, UnpackNormal(vertex_.normal), glm::unpackHalf2x16(vertex_.texCoords)};
+    }
+
+    Mesh::Vertex DecodeQuantizedVertex(const Mesh::QuantizedVertex& vertex_, const glm::vec3& offset_, const glm::vec3& scale_) noexcept
+    {
+        const glm::vec3 t(vertex_.position[0] / 65535.0f, vertex_.position[1] / 65535.0f, vertex_.position[2] / 65535.0f);
+        return Mesh::Vertex{offset_ + t * scale_, UnpackNormal(vertex_.normal), glm::unpackHalf2x16(vertex_.texCoords)};
+    }
+
+    /**
+     * @brief 정점들을 지정한 형식으로 압축했다가 셰이더가 읽을 값과 같게 복원하여 원본과 비교하고, 허용 오차를 넘으면 경고합니다.
+     *
+     * @details 로드 경로에 비용을 더하지 않도록 디버그 빌드에서만 메쉬를 만들거나 형식을 바꿀 때 한 번 검사합니다.
+     *
+     * @param originals_      원본 정점들
+     * @param vertexFormat_   검사할 정점 형식
+     * @param positionOffset_ Quantized 위치의 최소점
+     * @param positionScale_  Quantized 위치의 범위
+     */
+    void ValidateVertexFormat(const std::vector<Mesh::Vertex>& originals_,
+                              const Mesh::VertexFormat         vertexFormat_,
+                              const glm::vec3&                 positionOffset_,
+                              const glm::vec3&                 positionScale_) noexcept
+    {
+        if (vertexFormat_ == Mesh::VertexFormat::Float)
+        {
+            return;
+        }
+
+        const bool      isQuantized  = vertexFormat_ == Mesh::VertexFormat::Quantized;
+        const glm::vec3 positionStep = isQuantized ? positionScale_ / 65535.0f : glm::vec3(0.0f);
+        const char*     formatName   = isQuantized ? "Quantized" : "Packed";
+
+        // 위치는 반 간격(좌표가 클 때의 float 반올림 오차를 위해 2% 여유), 법선은 10비트 정밀도(약 0.1도), 텍스처 좌표는 half의 상대 정밀도(2^-11)를 조금 넉넉히 허용합니다.
+        const float     positionTolerance = glm::length(positionStep) * 0.51f + 1e-5f;
+        constexpr float NormalTolerance   = 4.0f / 511.0f;
+        constexpr float TexCoordTolerance = 1.0f / 1024.0f;
+
+        float positionError = 0.0f;
+        float normalError   = 0.0f;
+        float texCoordError = 0.0f;
+        for (const Mesh::Vertex& original : originals_)
+        {
+            const Mesh::Vertex decoded = isQuantized ? DecodeQuantizedVertex(EncodeQuantizedVertex(original, positionOffset_, positionScale_), positionOffset_, positionScale_)
+                                                     : DecodePackedVertex(EncodePackedVertex(original));
+
+            const glm::vec2 texCoordDifference = glm::abs(decoded.texCoords - original.texCoords);
+            const float     texCoordMagnitude  = std::max(1.0f, std::max(std::abs(original.texCoords.x), std::abs(original.texCoords.y)));
+
+            positionError = std::max(positionError, glm::length(decoded.position - original.position));
+            normalError   = std::max(normalError, glm::length(decoded.normal - glm::clamp(original.normal, -1.0f, 1.0f)));
+            texCoordError = std::max(texCoordError, std::max(texCoordDifference.x, texCoordDifference.y) / texCoordMagnitude);
+        }
+
+        if (positionError > positionTolerance || normalError > NormalTolerance || texCoordError > TexCoordTolerance)
+        {
+            Logger::Warn("Mesh {} vertices exceed tolerance: position {:.6f} (max {:.6f}), normal {:.6f} (max {:.6f}), uv {:.6f} (max {:.6f})",
+                         formatName,
+                         positionError,
+                         positionTolerance,
+                         normalError,
+                         NormalTolerance,
+                         texCoordError,
+                         TexCoordTolerance);
+        }
+    }
+#endif
+}
+
 Mesh::Mesh() noexcept
     : vao(0)
     , vbo(0)
     , ebo(0)
+    , indexType(GL_UNSIGNED_INT)
+    , vertexFormat(VertexFormat::Float)
+    , positionScale(1.0f)
+    , positionOffset(0.0f)
+    , lods(1, Lod{0, 0})
 {
     glGenVertexArrays(1, &vao);
     glGenBuffers(1, &vbo);
@@ -200,25 +382,78 @@ Mesh::Mesh() noexcept
 
 Mesh::~Mesh() noexcept
 {
-    if (vao != 0)
-    {
-        glDeleteVertexArrays(1, &vao);
-    }
-    if (vbo != 0)
+    GraphicsState::DeleteVertexArray(vao);
+    GraphicsState::DeleteBuffer(vbo);
+    GraphicsState::DeleteBuffer(ebo);
+}
+
+void Mesh::Draw() noexcept
+{
+    Bind();
+    Issue();
+}
+
+void Mesh::Issue(const std::uint32_t lod_) noexcept
+{
+    const Lod&        lod       = lods[std::min<std::size_t>(lod_, lods.size() - 1)];
+    const std::size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(unsigned int);
+
+    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(lod.indexCount), indexType, reinterpret_cast<void*>(lod.firstIndex * indexSize));
+
+    ++statistics.drawCallCount;
+    ++statistics.instanceCount;
+    statistics.triangleCount += lod.indexCount / 3;
+}
+
+void Mesh::IssueInstanced(const unsigned int  instanceBuffer_,
+                          const std::uint32_t firstInstance_,
+                          const std::uint32_t instanceCount_,
+                          const std::uint32_t lod_) noexcept
+{
+    if (instanceCount_ == 0)
     {
-        glDeleteBuffers(1, &vbo);
+        return;
     }
-    if (ebo != 0)
+
+    // 인스턴스 버퍼는 여러 메쉬가 공유하므로 그릴 때마다 VAO에 연결합니다.
+    GraphicsState::BindBuffer(GL_ARRAY_BUFFER, instanceBuffer_);
+    for (unsigned int column = 0; column < 4; ++column)
     {
-        glDeleteBuffers(1, &ebo);
+        const unsigned int attribute = InstanceAttribute + column;
+
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribPointer(attribute,
+                              4,
+                              GL_FLOAT,
+                              GL_FALSE,
+                              sizeof(InstanceData),
+                              reinterpret_cast<void*>(offsetof(InstanceData, model) + sizeof(glm::fvec4) * column));
+        glVertexAttribDivisor(attribute, 1);
     }
-}
 
-void Mesh::Draw() noexcept
-{
-    glBindVertexArray(vao);
-    glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, nullptr);
-    glBindVertexArray(0);
+    glEnableVertexAttribArray(InstanceLayerAttribute);
+    glVertexAttribPointer(InstanceLayerAttribute,
+                          1,
+                          GL_FLOAT,
+                          GL_FALSE,
+                          sizeof(InstanceData),
+                          reinterpret_cast<void*>(offsetof(InstanceData, textureLayer)));
+    glVertexAttribDivisor(InstanceLayerAttribute, 1);
+
+    const Lod&        lod       = lods[std::min<std::size_t>(lod_, lods.size() - 1)];
+    const std::size_t indexSize = indexType == GL_UNSIGNED_SHORT ? sizeof(std::uint16_t) : sizeof(unsigned int);
+
+    glDrawElementsInstancedBaseInstance(GL_TRIANGLES,
+                                        static_cast<GLsizei>(lod.indexCount),
+                                        indexType,
+                                        reinterpret_cast<void*>(lod.firstIndex * indexSize),
+                                        static_cast<GLsizei>(instanceCount_),
+                                        firstInstance_);
+
+    ++statistics.drawCallCount;
+    ++statistics.instancedDrawCallCount;
+    statistics.instanceCount += instanceCount_;
+    statistics.triangleCount += static_cast<std::size_t>(lod.indexCount / 3) * instanceCount_;
 }
 
 bool Mesh::Load(const std::filesystem::path& path_) noexcept
@@ -240,24 +475,15 @@ bool Mesh::Load(const std::filesystem::path& path_) noexcept
     if (!ret)
         return false;
 
-    // 기존 GL 리소스 정리
-    if (vao)
-        glDeleteVertexArrays(1, &vao);
-    if (vbo)
-        glDeleteBuffers(1, &vbo);
-    if (ebo)
-        glDeleteBuffers(1, &ebo);
-    vao = vbo = ebo = 0;
-
-    vertices.clear();
-    indices.clear();
+    std::vector<Vertex>       loadedVertices;
+    std::vector<unsigned int> loadedIndices;
 
     size_t totalFaces = 0;
     for (const auto& shape : shapes)
         totalFaces += shape.mesh.num_face_vertices.size();
 
-    vertices.reserve(totalFaces * 3);
-    indices.reserve(totalFaces * 3);
+    loadedVertices.reserve(totalFaces * 3);
+    loadedIndices.reserve(totalFaces * 3);
 
     glm::vec3 minP(FLT_MAX);
     glm::vec3 maxP(-FLT_MAX);
@@ -318,47 +544,1047 @@ bool Mesh::Load(const std::filesystem::path& path_) noexcept
                 vertex.normal    = n;
                 vertex.texCoords = uv[k];
 
-                vertices.push_back(vertex);
-                indices.push_back(static_cast<unsigned int>(vertices.size() - 1));
+                loadedVertices.push_back(vertex);
+                loadedIndices.push_back(static_cast<unsigned int>(loadedVertices.size() - 1));
             }
             index_offset += fv;
         }
     }
 
     glm::vec3 center = (minP + maxP) * 0.5f;
-    for (auto& v : vertices)
+    for (auto& v : loadedVertices)
     {
         v.position -= center;
     }
 
-    if (vao == 0)
-        glGenVertexArrays(1, &vao);
-    if (vbo == 0)
-        glGenBuffers(1, &vbo);
-    if (ebo == 0)
-        glGenBuffers(1, &ebo);
+    // 삼각형마다 새로 만든 정점들을 합친 뒤, 정점 캐시와 정점 읽기 순서에 맞게 다시 정렬합니다.
+    const std::size_t unweldedVertexCount = loadedVertices.size();
+    const float       unweldedAcmr        = MeshOptimizer::ComputeAcmr(loadedIndices, loadedVertices.size());
+
+    MeshOptimizer::WeldVertices(loadedVertices, loadedIndices);
+    const float weldedAcmr = MeshOptimizer::ComputeAcmr(loadedIndices, loadedVertices.size());
+
+    MeshOptimizer::OptimizeVertexCache(loadedIndices, loadedVertices.size());
+    MeshOptimizer::OptimizeVertexFetch(loadedVertices, loadedIndices);
+    const float optimizedAcmr = MeshOptimizer::ComputeAcmr(loadedIndices, loadedVertices.size());
+
+    Logger::Info("Mesh {}: {} -> {} vertices, ACMR {:.3f} -> {:.3f} (welded) -> {:.3f} (cache optimized)",
+                 path_.string(),
+                 unweldedVertexCount,
+                 loadedVertices.size(),
+                 unweldedAcmr,
+                 weldedAcmr,
+                 optimizedAcmr);
+
+    if (!Build(std::move(loadedVertices), std::move(loadedIndices)))
+    {
+        return false;
+    }
+
+    // 화면에서 작게 보일 때 그릴 LOD는 삼각형이 충분히 많은 메쉬에만 만듭니다.
+    if (indices.size() / 3 >= LodMinTriangleCount)
+    {
+        GenerateLods();
+
+        std::string triangleCounts;
+        for (std::uint32_t lod = 0; lod < GetLodCount(); ++lod)
+        {
+            triangleCounts += (lod == 0 ? "" : " -> ") + std::to_string(GetLodTriangleCount(lod));
+        }
+        Logger::Info("Mesh {}: {} LODs, {} triangles", path_.string(), GetLodCount(), triangleCounts);
+    }
 
-    glBindVertexArray(vao);
+    return true;
+}
 
-    glBindBuffer(GL_ARRAY_BUFFER, vbo);
-    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+bool Mesh::Build(std::vector<Vertex> vertices_, std::vector<unsigned int> indices_) noexcept
+{
+    vertices = std::move(vertices_);
+    indices  = std::move(indices_);
 
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), indices.data(), GL_STATIC_DRAW);
+    lodIndices.clear();
+    lods.assign(1, Lod{0, static_cast<std::uint32_t>(indices.size())});
 
-    glEnableVertexAttribArray(0);
-    glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+    // 경계를 보관하여 절두체 컬링에 사용합니다.
+    bounds = Bounds();
+    if (!vertices.empty())
+    {
+        glm::vec3 minP(FLT_MAX);
+        glm::vec3 maxP(-FLT_MAX);
+        for (const Vertex& vertex : vertices)
+        {
+            minP = glm::min(minP, vertex.position);
+            maxP = glm::max(maxP, vertex.position);
+        }
 
-    glEnableVertexAttribArray(1);
-    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+        bounds.center  = (minP + maxP) * 0.5f;
+        bounds.extents = (maxP - minP) * 0.5f;
+        for (const Vertex& vertex : vertices)
+        {
+            bounds.radius = std::max(bounds.radius, glm::length(vertex.position - bounds.center));
+        }
+    }
 
-    glEnableVertexAttribArray(2);
-    glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
+    Upload();
 
-    glBindVertexArray(0);
+#if defined(DEBUG) || defined(_DEBUG)
+    ValidateVertexFormat(vertices, vertexFormat, positionOffset, positionScale);
+#endif
 
     return true;
 }
+
+void Mesh::GenerateLods() noexcept
+{
+    lodIndices.clear();
+    lods.resize(1);
+
+    std::vector<unsigned int> previous = indices;
+    while (lods.size() < MaxLodCount)
+    {
+        const std::size_t         targetIndexCount = static_cast<std::size_t>(static_cast<float>(previous.size() / 3) * LodReduction) * 3;
+        std::vector<unsigned int> simplified       = MeshOptimizer::Simplify(vertices, previous, targetIndexCount);
+
+        // 이음매와 경계만 남아 10%도 줄지 않았다면 더 거친 LOD를 만들어도 이득이 없습니다.
+        if (simplified.empty() || simplified.size() * 10 > previous.size() * 9)
+        {
+            break;
+        }
+
+        MeshOptimizer::OptimizeVertexCache(simplified, vertices.size());
+
+        lods.push_back({static_cast<std::uint32_t>(indices.size() + lodIndices.size()), static_cast<std::uint32_t>(simplified.size())});
+        lodIndices.insert(lodIndices.end(), simplified.begin(), simplified.end());
+
+        previous = std::move(simplified);
+    }
+
+    if (!vertices.empty())
+    {
+        Upload();
+    }
+}
+
+void Mesh::SetVertexFormat(const VertexFormat vertexFormat_) noexcept
+{
+    if (vertexFormat == vertexFormat_)
+    {
+        return;
+    }
+
+    vertexFormat = vertexFormat_;
+    if (!vertices.empty())
+    {
+        Upload();
+
+#if defined(DEBUG) || defined(_DEBUG)
+        ValidateVertexFormat(vertices, vertexFormat, positionOffset, positionScale);
+#endif
+    }
+}
+
+void Mesh::Upload() noexcept
+{
+    // 기존 GL 리소스 정리
+    GraphicsState::DeleteVertexArray(vao);
+    GraphicsState::DeleteBuffer(vbo);
+    GraphicsState::DeleteBuffer(ebo);
+
+    glGenVertexArrays(1, &vao);
+    glGenBuffers(1, &vbo);
+    glGenBuffers(1, &ebo);
+
+    GraphicsState::BindVertexArray(vao);
+    GraphicsState::BindBuffer(GL_ARRAY_BUFFER, vbo);
+
+    // 양자화한 위치는 경계 상자의 최소점을 0, 최대점을 1로 하여 저장합니다.
+    if (vertexFormat == VertexFormat::Quantized)
+    {
+        positionOffset = bounds.center - bounds.extents;
+        positionScale  = bounds.extents * 2.0f;
+    }
+    else
+    {
+        positionOffset = glm::vec3(0.0f);
+        positionScale  = glm::vec3(1.0f);
+    }
+
+    switch (vertexFormat)
+    {
+        case VertexFormat::Float:
+        {
+            glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, normal));
+
+            glEnableVertexAttribArray(2);
+            glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, texCoords));
+
+            break;
+        }
+        case VertexFormat::Packed:
+        {
+            std::vector<PackedVertex> packedVertices(vertices.size());
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+            {
+                packedVertices[i] = EncodePackedVertex(vertices[i]);
+            }
+
+            glBufferData(GL_ARRAY_BUFFER, packedVertices.size() * sizeof(PackedVertex), packedVertices.data(), GL_STATIC_DRAW);
+
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, position));
+
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, normal));
+
+            glEnableVertexAttribArray(2);
+            glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(PackedVertex), (void*)offsetof(PackedVertex, texCoords));
+
+            break;
+        }
+        case VertexFormat::Quantized:
+        {
+            std::vector<QuantizedVertex> quantizedVertices(vertices.size());
+            for (std::size_t i = 0; i < vertices.size(); ++i)
+            {
+                quantizedVertices[i] = EncodeQuantizedVertex(vertices[i], positionOffset, positionScale);
+            }
+
+            glBufferData(GL_ARRAY_BUFFER, quantizedVertices.size() * sizeof(QuantizedVertex), quantizedVertices.data(), GL_STATIC_DRAW);
+
+            glEnableVertexAttribArray(0);
+            glVertexAttribPointer(0, 3, GL_UNSIGNED_SHORT, GL_TRUE, sizeof(QuantizedVertex), (void*)offsetof(QuantizedVertex, position));
+
+            glEnableVertexAttribArray(1);
+            glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(QuantizedVertex), (void*)offsetof(QuantizedVertex, normal));
+
+            glEnableVertexAttribArray(2);
+            glVertexAttribPointer(2, 2, GL_HALF_FLOAT, GL_FALSE, sizeof(QuantizedVertex), (void*)offsetof(QuantizedVertex, texCoords));
+
+            break;
+        }
+    }
+
+    // 정점이 65536개 이하라면 인덱스 버퍼의 크기와 인덱스 읽기 대역폭을 절반으로 줄입니다.
+    // LOD들의 인덱스는 원본 뒤에 이어 붙여 하나의 요소 배열 객체에 올립니다.
+    GraphicsState::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, ebo);
+    if (vertices.size() <= static_cast<std::size_t>(std::numeric_limits<std::uint16_t>::max()) + 1)
+    {
+        std::vector<std::uint16_t> shortIndices(indices.begin(), indices.end());
+        shortIndices.insert(shortIndices.end(), lodIndices.begin(), lodIndices.end());
+
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, shortIndices.size() * sizeof(std::uint16_t), shortIndices.data(), GL_STATIC_DRAW);
+        indexType = GL_UNSIGNED_SHORT;
+    }
+    else
+    {
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (indices.size() + lodIndices.size()) * sizeof(unsigned int), nullptr, GL_STATIC_DRAW);
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indices.size() * sizeof(unsigned int), indices.data());
+        glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(unsigned int), lodIndices.size() * sizeof(unsigned int), lodIndices.data());
+        indexType = GL_UNSIGNED_INT;
+    }
+}
+#pragma endregion
+
+#pragma region MeshBuilder Implementation
+void MeshBuilder::Append(const Mesh& mesh_, const glm::fmat4x4& transform_, const std::uint8_t faces_) noexcept
+{
+    const std::vector<Mesh::Vertex>& sourceVertices = mesh_.GetVertices();
+    const std::vector<unsigned int>& sourceIndices  = mesh_.GetIndices();
+    const glm::fmat3x3               normalMatrix   = glm::fmat3x3(transform_);
+
+    constexpr unsigned int Unmapped = std::numeric_limits<unsigned int>::max();
+    remap.assign(sourceVertices.size(), Unmapped);
+
+    for (std::size_t index = 0; index + 2 < sourceIndices.size(); index += 3)
+    {
+        const glm::vec3& p0 = sourceVertices[sourceIndices[index + 0]].position;
+        const glm::vec3& p1 = sourceVertices[sourceIndices[index + 1]].position;
+        const glm::vec3& p2 = sourceVertices[sourceIndices[index + 2]].position;
+
+        // 기하 법선의 가장 큰 성분으로 삼각형이 속한 면을 정합니다.
+        const glm::vec3 normal = glm::cross(p1 - p0, p2 - p0);
+        const glm::vec3 extent = glm::abs(normal);
+
+        std::uint8_t face;
+        if (extent.x >= extent.y && extent.x >= extent.z)
+        {
+            face = normal.x >= 0.0f ? PositiveX : NegativeX;
+        }
+        else if (extent.y >= extent.z)
+        {
+            face = normal.y >= 0.0f ? PositiveY : NegativeY;
+        }
+        else
+        {
+            face = normal.z >= 0.0f ? PositiveZ : NegativeZ;
+        }
+
+        if ((faces_ & face) == 0)
+        {
+            continue;
+        }
+
+        for (std::size_t corner = 0; corner < 3; ++corner)
+        {
+            const unsigned int sourceIndex = sourceIndices[index + corner];
+            if (remap[sourceIndex] == Unmapped)
+            {
+                const Mesh::Vertex& source = sourceVertices[sourceIndex];
+
+                Mesh::Vertex vertex{};
+                vertex.position  = glm::vec3(transform_ * glm::vec4(source.position, 1.0f));
+                vertex.normal    = normalMatrix * source.normal;
+                vertex.texCoords = source.texCoords;
+
+                remap[sourceIndex] = static_cast<unsigned int>(vertices.size());
+                vertices.push_back(vertex);
+            }
+
+            indices.push_back(remap[sourceIndex]);
+        }
+    }
+}
+
+std::unique_ptr<Mesh> MeshBuilder::Build(const Mesh::VertexFormat vertexFormat_) noexcept
+{
+    if (indices.empty())
+    {
+        vertices.clear();
+        return nullptr;
+    }
+
+    // 정점이 없는 메쉬에 형식을 먼저 정해 두면 처음부터 그 형식으로 한 번만 올립니다.
+    std::unique_ptr<Mesh> mesh = std::make_unique<Mesh>();
+    mesh->SetVertexFormat(vertexFormat_);
+    mesh->Build(std::move(vertices), std::move(indices));
+
+    vertices.clear();
+    indices.clear();
+
+    return mesh;
+}
+#pragma endregion
+
+#pragma region MeshOptimizer Implementation
+namespace
+{
+    /**
+     * @brief 정점을 비트 단위로 비교하기 위한 용접 키. -0.0은 0.0으로 바꾸어 담습니다.
+     */
+    struct WeldKey final
+    {
+        std::array<std::uint32_t, 8> bits;
+
+        bool operator==(const WeldKey&) const noexcept = default;
+    };
+
+    /**
+     * @brief 용접 키의 FNV-1a 해시.
+     */
+    struct WeldKeyHash final
+    {
+        std::size_t operator()(const WeldKey& key_) const noexcept
+        {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (const std::uint32_t word : key_.bits)
+            {
+                hash = (hash ^ word) * 1099511628211ull;
+            }
+            return static_cast<std::size_t>(hash);
+        }
+    };
+
+    WeldKey MakeWeldKey(const Mesh::Vertex& vertex_) noexcept
+    {
+        const std::array<float, 8> values = {vertex_.position.x,
+                                             vertex_.position.y,
+                                             vertex_.position.z,
+                                             vertex_.normal.x,
+                                             vertex_.normal.y,
+                                             vertex_.normal.z,
+                                             vertex_.texCoords.x,
+                                             vertex_.texCoords.y};
+
+        WeldKey key;
+        for (std::size_t i = 0; i < values.size(); ++i)
+        {
+            const float value = values[i] + 0.0f;
+            std::memcpy(&key.bits[i], &value, sizeof(float));
+        }
+        return key;
+    }
+
+    /**
+     * @brief Forsyth 정점 점수. 방금 사용한 삼각형의 정점과 남은 삼각형이 적은 정점일수록 높습니다.
+     */
+    float ComputeForsythScore(const int cachePosition_, const unsigned int remainingTriangles_) noexcept
+    {
+        constexpr float CacheDecayPower   = 1.5f;
+        constexpr float LastTriangleScore = 0.75f;
+        constexpr float ValenceBoostScale = 2.0f;
+        constexpr float ValenceBoostPower = 0.5f;
+
+        if (remainingTriangles_ == 0)
+        {
+            return -1.0f;
+        }
+
+        float score = 0.0f;
+        if (cachePosition_ >= 0)
+        {
+            if (cachePosition_ < 3)
+            {
+                score = LastTriangleScore;
+            }
+            else
+            {
+                constexpr float scale = 1.0f / static_cast<float>(MeshOptimizer::OptimizerCacheSize - 3);
+                score = std::pow(1.0f - static_cast<float>(cachePosition_ - 3) * scale, CacheDecayPower);
+            }
+        }
+
+        return score + ValenceBoostScale * std::pow(static_cast<float>(remainingTriangles_), -ValenceBoostPower);
+    }
+
+    /**
+     * @brief 평면들까지의 거리 제곱 합을 나타내는 대칭 4x4 이차 오차 행렬. 위쪽 삼각형의 10개 성분만 담습니다.
+     */
+    struct Quadric final
+    {
+        std::array<double, 10> values{};
+
+        Quadric& operator+=(const Quadric& other_) noexcept
+        {
+            for (std::size_t i = 0; i < values.size(); ++i)
+            {
+                values[i] += other_.values[i];
+            }
+            return *this;
+        }
+    };
+
+    /**
+     * @brief 삼각형 평면의 이차 오차 행렬을 만듭니다. 큰 삼각형일수록 모양을 지키도록 넓이로 가중합니다.
+     */
+    Quadric MakePlaneQuadric(const glm::vec3& p0_, const glm::vec3& p1_, const glm::vec3& p2_) noexcept
+    {
+        const glm::vec3 normal = glm::cross(p1_ - p0_, p2_ - p0_);
+        const float     length = glm::length(normal);
+        if (length <= 0.0f)
+        {
+            return Quadric();
+        }
+
+        const double a      = normal.x / length;
+        const double b      = normal.y / length;
+        const double c      = normal.z / length;
+        const double d      = -(a * p0_.x + b * p0_.y + c * p0_.z);
+        const double weight = length * 0.5;
+
+        Quadric quadric;
+        quadric.values = {a * a, a * b, a * c, a * d, b * b, b * c, b * d, c * c, c * d, d * d};
+        for (double& value : quadric.values)
+        {
+            value *= weight;
+        }
+        return quadric;
+    }
+
+    /**
+     * @brief 위치를 이차 오차 행렬에 대입하여 평면들까지의 가중 거리 제곱 합을 구합니다.
+     */
+    double EvaluateQuadric(const Quadric& quadric_, const glm::vec3& position_) noexcept
+    {
+        const double x = position_.x;
+        const double y = position_.y;
+        const double z = position_.z;
+
+        const std::array<double, 10>& q = quadric_.values;
+
+        const double error = q[0] * x * x + 2.0 * q[1] * x * y + 2.0 * q[2] * x * z + 2.0 * q[3] * x +
+                             q[4] * y * y + 2.0 * q[5] * y * z + 2.0 * q[6] * y +
+                             q[7] * z * z + 2.0 * q[8] * z +
+                             q[9];
+
+        // 반올림 오차로 음수가 될 수 있습니다.
+        return std::abs(error);
+    }
+
+    /**
+     * @brief 모서리 접기 후보. from 정점을 to 정점으로 옮깁니다.
+     */
+    struct EdgeCollapse final
+    {
+        double       cost;
+        unsigned int from;
+        unsigned int to;
+    };
+}
+
+void MeshOptimizer::WeldVertices(std::vector<Mesh::Vertex>& vertices_, std::vector<unsigned int>& indices_) noexcept
+{
+    std::unordered_map<WeldKey, unsigned int, WeldKeyHash> uniqueVertices;
+    uniqueVertices.reserve(vertices_.size());
+
+    std::vector<Mesh::Vertex> welded;
+    welded.reserve(vertices_.size());
+
+    std::vector<unsigned int> remap(vertices_.size());
+    for (std::size_t i = 0; i < vertices_.size(); ++i)
+    {
+        const auto [it, isInserted] = uniqueVertices.try_emplace(MakeWeldKey(vertices_[i]), static_cast<unsigned int>(welded.size()));
+        if (isInserted)
+        {
+            welded.push_back(vertices_[i]);
+        }
+        remap[i] = it->second;
+    }
+
+    for (unsigned int& index : indices_)
+    {
+        index = remap[index];
+    }
+
+    vertices_ = std::move(welded);
+}
+
+void MeshOptimizer::OptimizeVertexCache(std::vector<unsigned int>& indices_, const std::size_t vertexCount_) noexcept
+{
+    constexpr std::size_t InvalidTriangle = std::numeric_limits<std::size_t>::max();
+
+    const std::size_t triangleCount = indices_.size() / 3;
+    if (triangleCount == 0 || vertexCount_ == 0)
+    {
+        return;
+    }
+
+    // 정점마다 인접한 삼각형 목록을 만듭니다. 내보낸 삼각형은 목록의 뒤로 옮겨 남은 개수만큼만 봅니다.
+    std::vector<unsigned int> adjacencyOffsets(vertexCount_ + 1, 0);
+    for (std::size_t i = 0; i < triangleCount * 3; ++i)
+    {
+        ++adjacencyOffsets[indices_[i] + 1];
+    }
+    std::partial_sum(adjacencyOffsets.begin(), adjacencyOffsets.end(), adjacencyOffsets.begin());
+
+    std::vector<unsigned int> remainingTriangles(vertexCount_);
+    std::vector<unsigned int> adjacency(triangleCount * 3);
+    for (std::size_t i = 0; i < triangleCount * 3; ++i)
+    {
+        const unsigned int vertex = indices_[i];
+        adjacency[adjacencyOffsets[vertex] + remainingTriangles[vertex]++] = static_cast<unsigned int>(i / 3);
+    }
+
+    std::vector<int>   cachePositions(vertexCount_, -1);
+    std::vector<float> vertexScores(vertexCount_);
+    for (std::size_t vertex = 0; vertex < vertexCount_; ++vertex)
+    {
+        vertexScores[vertex] = ComputeForsythScore(-1, remainingTriangles[vertex]);
+    }
+
+    std::vector<float> triangleScores(triangleCount);
+    std::vector<bool>  isEmitted(triangleCount, false);
+    std::size_t        bestTriangle = 0;
+    for (std::size_t triangle = 0; triangle < triangleCount; ++triangle)
+    {
+        triangleScores[triangle] = vertexScores[indices_[triangle * 3 + 0]] +
+                                   vertexScores[indices_[triangle * 3 + 1]] +
+                                   vertexScores[indices_[triangle * 3 + 2]];
+
+        if (triangleScores[triangle] > triangleScores[bestTriangle])
+        {
+            bestTriangle = triangle;
+        }
+    }
+
+    std::vector<unsigned int> output;
+    output.reserve(triangleCount * 3);
+
+    std::vector<unsigned int> cache;
+    std::vector<unsigned int> nextCache;
+    cache.reserve(OptimizerCacheSize + 3);
+    nextCache.reserve(OptimizerCacheSize + 3);
+
+    std::size_t scanCursor = 0;
+    for (std::size_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+    {
+        // 캐시 주변에 남은 삼각형이 없다면 아직 내보내지 않은 첫 삼각형에서 다시 시작합니다.
+        if (bestTriangle == InvalidTriangle)
+        {
+            while (isEmitted[scanCursor])
+            {
+                ++scanCursor;
+            }
+            bestTriangle = scanCursor;
+        }
+
+        isEmitted[bestTriangle] = true;
+
+        const unsigned int corners[3] = {indices_[bestTriangle * 3 + 0],
+                                         indices_[bestTriangle * 3 + 1],
+                                         indices_[bestTriangle * 3 + 2]};
+        output.insert(output.end(), std::begin(corners), std::end(corners));
+
+        for (const unsigned int vertex : corners)
+        {
+            const auto begin = adjacency.begin() + adjacencyOffsets[vertex];
+            const auto end   = begin + remainingTriangles[vertex];
+            const auto it    = std::find(begin, end, static_cast<unsigned int>(bestTriangle));
+            if (it != end)
+            {
+                std::iter_swap(it, end - 1);
+                --remainingTriangles[vertex];
+            }
+        }
+
+        // 방금 사용한 정점들을 LRU 캐시의 앞에 넣고, 나머지는 뒤로 밀어냅니다.
+        nextCache.assign(std::begin(corners), std::end(corners));
+        for (const unsigned int vertex : cache)
+        {
+            if (vertex != corners[0] && vertex != corners[1] && vertex != corners[2])
+            {
+                nextCache.push_back(vertex);
+            }
+        }
+        std::swap(cache, nextCache);
+
+        for (std::size_t position = 0; position < cache.size(); ++position)
+        {
+            const unsigned int vertex = cache[position];
+            cachePositions[vertex]    = position < OptimizerCacheSize ? static_cast<int>(position) : -1;
+            vertexScores[vertex]      = ComputeForsythScore(cachePositions[vertex], remainingTriangles[vertex]);
+        }
+
+        // 점수가 바뀐 정점들의 남은 삼각형만 다시 계산하여 다음 삼각형을 고릅니다.
+        bestTriangle    = InvalidTriangle;
+        float bestScore = -1.0f;
+        for (const unsigned int vertex : cache)
+        {
+            const auto begin = adjacency.begin() + adjacencyOffsets[vertex];
+            const auto end   = begin + remainingTriangles[vertex];
+            for (auto it = begin; it != end; ++it)
+            {
+                const unsigned int triangle = *it;
+
+                triangleScores[triangle] = vertexScores[indices_[triangle * 3 + 0]] +
+                                           vertexScores[indices_[triangle * 3 + 1]] +
+                                           vertexScores[indices_[triangle * 3 + 2]];
+
+                if (triangleScores[triangle] > bestScore)
+                {
+                    bestScore    = triangleScores[triangle];
+                    bestTriangle = triangle;
+                }
+            }
+        }
+
+        if (cache.size() > OptimizerCacheSize)
+        {
+            cache.resize(OptimizerCacheSize);
+        }
+    }
+
+    indices_ = std::move(output);
+}
+
+void MeshOptimizer::OptimizeVertexFetch(std::vector<Mesh::Vertex>& vertices_, std::vector<unsigned int>& indices_) noexcept
+{
+    constexpr unsigned int Unmapped = std::numeric_limits<unsigned int>::max();
+
+    std::vector<unsigned int> remap(vertices_.size(), Unmapped);
+
+    std::vector<Mesh::Vertex> reordered;
+    reordered.reserve(vertices_.size());
+
+    for (unsigned int& index : indices_)
+    {
+        if (remap[index] == Unmapped)
+        {
+            remap[index] = static_cast<unsigned int>(reordered.size());
+            reordered.push_back(vertices_[index]);
+        }
+        index = remap[index];
+    }
+
+    vertices_ = std::move(reordered);
+}
+
+float MeshOptimizer::ComputeAcmr(const std::vector<unsigned int>& indices_,
+                                 const std::size_t                vertexCount_,
+                                 const std::size_t                cacheSize_) noexcept
+{
+    const std::size_t triangleCount = indices_.size() / 3;
+    if (triangleCount == 0)
+    {
+        return 0.0f;
+    }
+
+    // 정점이 캐시에 들어간 시각을 기록하면, 그 뒤로 cacheSize_번 넘게 다른 정점이 들어왔을 때 밀려난 것으로 볼 수 있습니다.
+    std::vector<std::size_t> insertedTimes(vertexCount_, 0);
+    std::size_t              time      = cacheSize_ + 1;
+    std::size_t              missCount = 0;
+
+    for (std::size_t i = 0; i < triangleCount * 3; ++i)
+    {
+        const unsigned int vertex = indices_[i];
+        if (time - insertedTimes[vertex] > cacheSize_)
+        {
+            insertedTimes[vertex] = time++;
+            ++missCount;
+        }
+    }
+
+    return static_cast<float>(missCount) / static_cast<float>(triangleCount);
+}
+
+std::vector<unsigned int> MeshOptimizer::Simplify(const std::vector<Mesh::Vertex>& vertices_,
+                                                  const std::vector<unsigned int>& indices_,
+                                                  const std::size_t                targetIndexCount_) noexcept
+{
+    std::vector<unsigned int> indices = indices_;
+
+    const std::size_t vertexCount         = vertices_.size();
+    const std::size_t targetTriangleCount = targetIndexCount_ / 3;
+    if (indices.size() / 3 <= targetTriangleCount)
+    {
+        return indices;
+    }
+
+    // 위치가 같은 정점들을 하나의 묶음으로 보고, 정렬했을 때 처음 나온 정점을 묶음의 대표로 삼습니다.
+    std::vector<unsigned int> order(vertexCount);
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [&vertices_](const unsigned int lhs_, const unsigned int rhs_) {
+        const glm::vec3& lhs = vertices_[lhs_].position;
+        const glm::vec3& rhs = vertices_[rhs_].position;
+        return std::tie(lhs.x, lhs.y, lhs.z) < std::tie(rhs.x, rhs.y, rhs.z);
+    });
+
+    std::vector<unsigned int> positionGroups(vertexCount);
+    std::vector<unsigned int> groupSizes(vertexCount, 0);
+    for (std::size_t i = 0; i < vertexCount; ++i)
+    {
+        const bool isNewGroup = i == 0 || vertices_[order[i]].position != vertices_[order[i - 1]].position;
+
+        positionGroups[order[i]] = isNewGroup ? order[i] : positionGroups[order[i - 1]];
+        ++groupSizes[positionGroups[order[i]]];
+    }
+
+    // 텍스처 좌표가 나뉘는 이음매는 같은 위치에 정점이 둘 이상 있습니다. 옮기면 이음매가 벌어지므로 고정합니다.
+    std::vector<bool> isGroupLocked(vertexCount, false);
+    for (std::size_t group = 0; group < vertexCount; ++group)
+    {
+        isGroupLocked[group] = groupSizes[group] > 1;
+    }
+
+    // 삼각형 둘이 공유하지 않는 모서리는 열린 경계(또는 비다양체)이므로 윤곽을 지키도록 양 끝을 고정합니다.
+    std::unordered_map<std::uint64_t, unsigned int> edgeUseCounts;
+    edgeUseCounts.reserve(indices.size());
+    for (std::size_t i = 0; i < indices.size(); i += 3)
+    {
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            const std::uint64_t a = positionGroups[indices[i + k]];
+            const std::uint64_t b = positionGroups[indices[i + (k + 1) % 3]];
+            ++edgeUseCounts[std::min(a, b) << 32 | std::max(a, b)];
+        }
+    }
+    for (const auto& [edge, useCount] : edgeUseCounts)
+    {
+        if (useCount != 2)
+        {
+            isGroupLocked[edge >> 32]         = true;
+            isGroupLocked[edge & 0xFFFFFFFFu] = true;
+        }
+    }
+
+    std::vector<Quadric> quadrics(vertexCount);
+    for (std::size_t i = 0; i < indices.size(); i += 3)
+    {
+        const Quadric quadric = MakePlaneQuadric(vertices_[indices[i]].position,
+                                                 vertices_[indices[i + 1]].position,
+                                                 vertices_[indices[i + 2]].position);
+        for (std::size_t k = 0; k < 3; ++k)
+        {
+            quadrics[positionGroups[indices[i + k]]] += quadric;
+        }
+    }
+
+    // 접힌 정점은 옮겨 간 정점을 가리킵니다. 한 패스 안에서 옮겨 간 정점은 다시 접히지 않으므로 사슬은 패스마다 한 단계씩만 길어집니다.
+    std::vector<unsigned int> remap(vertexCount);
+    std::iota(remap.begin(), remap.end(), 0u);
+
+    const auto resolve = [&remap](unsigned int vertex_) {
+        while (remap[vertex_] != vertex_)
+        {
+            vertex_ = remap[vertex_];
+        }
+        return vertex_;
+    };
+
+    std::vector<EdgeCollapse> collapses;
+    std::vector<unsigned int> triangleOffsets(vertexCount + 1);
+    std::vector<unsigned int> adjacentTriangles;
+    std::vector<bool>         isTouched(vertexCount);
+    std::size_t               triangleCount = indices.size() / 3;
+
+    while (triangleCount > targetTriangleCount)
+    {
+        // 각 모서리는 비용이 낮은 방향으로 한 번만 후보에 올립니다. 반대 방향으로 공유하는 모서리는 한쪽에서만 셉니다.
+        collapses.clear();
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        {
+            for (std::size_t k = 0; k < 3; ++k)
+            {
+                const unsigned int a = indices[i + k];
+                const unsigned int b = indices[i + (k + 1) % 3];
+                if (a > b)
+                {
+                    continue;
+                }
+
+                Quadric quadric = quadrics[positionGroups[a]];
+                quadric += quadrics[positionGroups[b]];
+
+                const bool   canMoveA = !isGroupLocked[positionGroups[a]];
+                const bool   canMoveB = !isGroupLocked[positionGroups[b]];
+                const double costAB   = canMoveA ? EvaluateQuadric(quadric, vertices_[b].position) : std::numeric_limits<double>::max();
+                const double costBA   = canMoveB ? EvaluateQuadric(quadric, vertices_[a].position) : std::numeric_limits<double>::max();
+
+                if (canMoveA && costAB <= costBA)
+                {
+                    collapses.push_back({costAB, a, b});
+                }
+                else if (canMoveB)
+                {
+                    collapses.push_back({costBA, b, a});
+                }
+            }
+        }
+
+        if (collapses.empty())
+        {
+            break;
+        }
+
+        std::sort(collapses.begin(), collapses.end(), [](const EdgeCollapse& lhs_, const EdgeCollapse& rhs_) {
+            return lhs_.cost < rhs_.cost;
+        });
+
+        // 접기 한 번에 삼각형이 대략 두 개 줄어듭니다. 필요한 만큼의 가장 싼 후보까지만 보아, 비싼 접기가 다음 패스의 싼 접기보다 먼저 일어나지 않게 합니다.
+        const std::size_t neededCollapseCount = std::min((triangleCount - targetTriangleCount + 1) / 2, collapses.size());
+        const double      costLimit           = collapses[std::max<std::size_t>(neededCollapseCount, 1) - 1].cost;
+
+        // 정점마다 자신을 사용하는 삼각형들을 모읍니다.
+        std::fill(triangleOffsets.begin(), triangleOffsets.end(), 0u);
+        for (const unsigned int index : indices)
+        {
+            ++triangleOffsets[index + 1];
+        }
+        std::partial_sum(triangleOffsets.begin(), triangleOffsets.end(), triangleOffsets.begin());
+
+        adjacentTriangles.resize(indices.size());
+        std::vector<unsigned int> cursors(triangleOffsets.begin(), triangleOffsets.end() - 1);
+        for (std::size_t i = 0; i < indices.size(); ++i)
+        {
+            adjacentTriangles[cursors[indices[i]]++] = static_cast<unsigned int>(i / 3);
+        }
+
+        // 이번 패스에서 움직이거나 다른 정점을 받은 정점은 다시 건드리지 않아, 후보의 비용과 이웃 정보가 유효하게 유지됩니다.
+        std::fill(isTouched.begin(), isTouched.end(), false);
+        std::size_t collapseCount = 0;
+
+        for (const EdgeCollapse& collapse : collapses)
+        {
+            if (triangleCount <= targetTriangleCount || collapse.cost > costLimit)
+            {
+                break;
+            }
+
+            if (isTouched[collapse.from] || isTouched[collapse.to])
+            {
+                continue;
+            }
+
+            const glm::vec3& target = vertices_[collapse.to].position;
+
+            std::size_t removedTriangleCount = 0;
+            bool        isFlipped            = false;
+            for (unsigned int t = triangleOffsets[collapse.from]; t < triangleOffsets[collapse.from + 1] && !isFlipped; ++t)
+            {
+                const std::size_t                 triangle = adjacentTriangles[t] * std::size_t(3);
+                const std::array<unsigned int, 3> corners  = {resolve(indices[triangle]), resolve(indices[triangle + 1]), resolve(indices[triangle + 2])};
+
+                if (corners[0] == corners[1] || corners[1] == corners[2] || corners[2] == corners[0])
+                {
+                    continue;
+                }
+
+                if (corners[0] == collapse.to || corners[1] == collapse.to || corners[2] == collapse.to)
+                {
+                    ++removedTriangleCount;
+                    continue;
+                }
+
+                std::array<glm::vec3, 3> positions = {vertices_[corners[0]].position, vertices_[corners[1]].position, vertices_[corners[2]].position};
+                const glm::vec3          before    = glm::cross(positions[1] - positions[0], positions[2] - positions[0]);
+                for (std::size_t k = 0; k < 3; ++k)
+                {
+                    if (corners[k] == collapse.from)
+                    {
+                        positions[k] = target;
+                    }
+                }
+                const glm::vec3 after = glm::cross(positions[1] - positions[0], positions[2] - positions[0]);
+
+                isFlipped = glm::dot(before, after) <= 0.0f;
+            }
+
+            if (isFlipped)
+            {
+                continue;
+            }
+
+            remap[collapse.from] = collapse.to;
+            quadrics[positionGroups[collapse.to]] += quadrics[positionGroups[collapse.from]];
+
+            isTouched[collapse.from] = true;
+            isTouched[collapse.to]   = true;
+
+            triangleCount -= std::min(removedTriangleCount, triangleCount);
+            ++collapseCount;
+        }
+
+        if (collapseCount == 0)
+        {
+            break;
+        }
+
+        // 접힌 정점을 옮겨 간 정점으로 바꾸고, 넓이가 없어진 삼각형을 제거합니다.
+        std::size_t writeIndex = 0;
+        for (std::size_t i = 0; i < indices.size(); i += 3)
+        {
+            const unsigned int a = resolve(indices[i]);
+            const unsigned int b = resolve(indices[i + 1]);
+            const unsigned int c = resolve(indices[i + 2]);
+            if (a == b || b == c || c == a)
+            {
+                continue;
+            }
+
+            indices[writeIndex++] = a;
+            indices[writeIndex++] = b;
+            indices[writeIndex++] = c;
+        }
+        indices.resize(writeIndex);
+        triangleCount = indices.size() / 3;
+    }
+
+    return indices;
+}
+#pragma endregion
+
+#pragma region TextureArrayBuilder Implementation
+TextureArrayBuilder::TextureArrayBuilder(const int width_, const int height_) noexcept
+    : width(width_)
+    , height(height_)
+{
+}
+
+std::uint32_t TextureArrayBuilder::Add(const std::filesystem::path& path_) noexcept
+{
+    const std::string path = path_.string();
+
+    const auto it = std::find(layers.begin(), layers.end(), path);
+    if (it != layers.end())
+    {
+        return static_cast<std::uint32_t>(it - layers.begin());
+    }
+
+    const std::size_t layerSize = static_cast<std::size_t>(width) * height * 4;
+    const std::size_t offset    = pixels.size();
+
+    // 실패하더라도 레이어 번호가 밀리지 않도록, 바인딩되지 않은 텍스처처럼 불투명한 검은색으로 채워 둡니다.
+    pixels.resize(offset + layerSize, 0);
+    for (std::size_t alpha = offset + 3; alpha < pixels.size(); alpha += 4)
+    {
+        pixels[alpha] = 255;
+    }
+
+    layers.push_back(path);
+    const std::uint32_t layer = static_cast<std::uint32_t>(layers.size() - 1);
+
+    // Texture::Load와 같은 방향으로 읽습니다.
+    stbi_set_flip_vertically_on_load(true);
+
+    int            imageWidth    = 0;
+    int            imageHeight   = 0;
+    int            imageChannels = 0;
+    unsigned char* data          = stbi_load(path.c_str(), &imageWidth, &imageHeight, &imageChannels, 4);
+    if (!data)
+    {
+        Logger::Error("Failed to load texture array layer image: {}", path);
+        return layer;
+    }
+
+    if (imageWidth == width && imageHeight == height)
+    {
+        std::memcpy(pixels.data() + offset, data, layerSize);
+    }
+    else
+    {
+        stbir_resize_uint8_linear(data, imageWidth, imageHeight, 0, pixels.data() + offset, width, height, 0, STBIR_RGBA);
+    }
+
+    stbi_image_free(data);
+
+    return layer;
+}
+
+std::unique_ptr<TextureArray> TextureArrayBuilder::Build() noexcept
+{
+    if (layers.empty())
+    {
+        return nullptr;
+    }
+
+    std::unique_ptr<TextureArray> textureArray = std::make_unique<TextureArray>();
+    textureArray->width    = width;
+    textureArray->height   = height;
+    textureArray->channels = 4;
+    textureArray->layers   = layers;
+
+    glGenTextures(1, &textureArray->textureID);
+    GraphicsState::BindTexture(0, GL_TEXTURE_2D_ARRAY, textureArray->textureID);
+
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    glTexImage3D(GL_TEXTURE_2D_ARRAY,
+                 0,
+                 GL_RGBA8,
+                 width,
+                 height,
+                 static_cast<GLsizei>(layers.size()),
+                 0,
+                 GL_RGBA,
+                 GL_UNSIGNED_BYTE,
+                 pixels.data());
+    glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
+
+    Logger::Info("Texture array built: {} layers ({}x{})", layers.size(), width, height);
+
+    layers.clear();
+    pixels.clear();
+
+    return textureArray;
+}
 #pragma endregion
 
 #pragma region AudioClip Implementation
@@ -506,7 +1732,7 @@ bool Font::Load(const std::filesystem::path& path_) noexcept
 
         unsigned int texture;
         glGenTextures(1, &texture);
-        glBindTexture(GL_TEXTURE_2D, texture);
+        GraphicsState::BindTexture(0, GL_TEXTURE_2D, texture);
 
         glTexImage2D(GL_TEXTURE_2D,
                      0,
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Common.h"
+#include "Graphics.h"
 
 class ResourceManager;
 
@@ -162,6 +163,17 @@ class Texture : public Resource
         return height;
     }
 
+    /**
+     * @brief 해당 텍스쳐의 타깃을 반환합니다.
+     *
+     * @return unsigned int GL_TEXTURE_2D 또는 GL_TEXTURE_2D_ARRAY
+     */
+    [[nodiscard]]
+    inline unsigned int GetTarget() const noexcept
+    {
+        return target;
+    }
+
     /**
      * @brief 해당 텍스쳐를 바인딩합니다.
      */
@@ -177,7 +189,11 @@ class Texture : public Resource
      */
     virtual bool Load(const std::filesystem::path& path_) noexcept override;
 
-private:
+    /**
+     * @brief 해당 텍스쳐의 타깃.
+     */
+    unsigned int target;
+
     /**
      * @brief 해당 텍스쳐의 ID.
      */
@@ -199,6 +215,68 @@ class Texture : public Resource
     int channels;
 };
 
+/**
+ * @class TextureArray
+ *
+ * @brief 같은 크기와 형식의 텍스처들을 레이어로 묶은 GL_TEXTURE_2D_ARRAY 텍스처입니다.
+ *
+ * @details 서로 다른 이미지를 쓰는 렌더러들도 같은 텍스처를 바인딩하게 되므로 상태 변경 없이 이어서 그리거나 인스턴싱으로 묶을 수 있습니다.
+ *          렌더러는 SetTextureLayer로 레이어를 지정하며, 셰이더는 sampler2DArray와 textureLayer 유니폼(또는 인스턴스 속성)을 사용해야 합니다.
+ *          파일에서 직접 로드할 수 없으며 TextureArrayBuilder로 만들어 ResourceManager::AddResource로 등록합니다.
+ */
+class TextureArray final : public Texture
+{
+    friend class TextureArrayBuilder;
+
+public:
+    /**
+     * @brief 찾는 이미지가 없음을 나타내는 레이어.
+     */
+    static constexpr std::uint32_t InvalidLayer = std::numeric_limits<std::uint32_t>::max();
+
+    /**
+     * @brief 생성자.
+     */
+    explicit TextureArray() noexcept;
+
+    /**
+     * @brief 레이어의 개수를 반환합니다.
+     *
+     * @return std::uint32_t 레이어의 개수
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetLayerCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(layers.size());
+    }
+
+    /**
+     * @brief 이미지 경로로 레이어를 찾습니다.
+     *
+     * @param path_ TextureArrayBuilder::Add에 전달했던 이미지 경로
+     *
+     * @return std::uint32_t 레이어. 없다면 InvalidLayer
+     */
+    [[nodiscard]]
+    std::uint32_t FindLayer(const std::filesystem::path& path_) const noexcept;
+
+protected:
+    /**
+     * @brief 텍스처 배열은 파일에서 로드할 수 없으므로 항상 실패합니다.
+     *
+     * @param path_ 리소스 경로
+     *
+     * @return bool 항상 false
+     */
+    virtual bool Load(const std::filesystem::path& path_) noexcept override;
+
+private:
+    /**
+     * @brief 레이어 순서대로 나열한 원본 이미지 경로들.
+     */
+    std::vector<std::string> layers;
+};
+
 class Font : public Resource
 {
 public:
@@ -241,6 +319,73 @@ class Font : public Resource
     std::map<char, Character> characters;
 };
 
+/**
+ * @struct UniformName
+ *
+ * @brief 컴파일 시간에 해시된 유니폼 변수 이름을 정의합니다.
+ */
+struct UniformName final
+{
+    /**
+     * @brief 생성자. 문자열 리터럴로부터 암시적으로 생성되며, 해시는 컴파일 시간에 계산됩니다.
+     *
+     * @param name_ 유니폼 변수 이름
+     */
+    consteval UniformName(const char* const name_) noexcept
+        : hash(Hash(name_))
+        , name(name_)
+    {
+    }
+
+    /**
+     * @brief 유니폼 변수 이름의 FNV-1a 해시를 계산합니다.
+     *
+     * @param name_ 유니폼 변수 이름
+     *
+     * @return std::uint32_t 해시 값
+     */
+    [[nodiscard]]
+    static constexpr std::uint32_t Hash(const std::string_view name_) noexcept
+    {
+        std::uint32_t hash = 2166136261u;
+        for (const char character : name_)
+        {
+            hash ^= static_cast<std::uint8_t>(character);
+            hash *= 16777619u;
+        }
+
+        return hash;
+    }
+
+    /**
+     * @brief 유니폼 변수 이름의 해시.
+     */
+    std::uint32_t hash;
+
+    /**
+     * @brief 유니폼 변수 이름.
+     */
+    const char* name;
+};
+
+/**
+ * @struct UniformStatistics
+ *
+ * @brief 유니폼 변수 설정 통계를 정의합니다.
+ */
+struct UniformStatistics
+{
+    /**
+     * @brief 실제로 호출한 glProgramUniform*의 개수.
+     */
+    std::size_t issuedCallCount = 0;
+
+    /**
+     * @brief 캐시된 위치와 값 덕분에 생략한 GL 호출(glGetUniformLocation, 값이 같은 glProgramUniform*)의 개수.
+     */
+    std::size_t avoidedCallCount = 0;
+};
+
 /**
  * @class Shader
  *
@@ -249,6 +394,21 @@ class Font : public Resource
 class Shader : public Resource
 {
 public:
+    /**
+     * @brief 유니폼 변수 테이블의 인덱스.
+     */
+    using UniformHandle = std::uint32_t;
+
+    /**
+     * @brief 유효하지 않은 유니폼 변수 핸들. 셰이더에서 사용하지 않는 변수를 가리킵니다.
+     */
+    static constexpr UniformHandle InvalidUniform = std::numeric_limits<UniformHandle>::max();
+
+    /**
+     * @brief 프레임 상수 유니폼 블록(FrameConstants)이 연결되는 바인딩 지점.
+     */
+    static constexpr unsigned int FrameBlockBinding = 0;
+
     /**
      * @brief 생성자.
      */
@@ -264,7 +424,7 @@ class Shader : public Resource
      */
     inline void Use() noexcept
     {
-        glUseProgram(programID);
+        GraphicsState::UseProgram(programID);
     }
 
     /**
@@ -278,16 +438,82 @@ class Shader : public Resource
         return programID;
     }
 
+    /**
+     * @brief 지정한 이름의 유니폼 변수 핸들을 찾습니다. 자주 설정하는 변수는 핸들을 저장해 두고 사용합니다.
+     *
+     * @param name_ 유니폼 변수 이름
+     *
+     * @return UniformHandle 유니폼 변수 핸들. 셰이더에서 사용하지 않는 변수라면 InvalidUniform
+     */
+    [[nodiscard]]
+    inline UniformHandle FindUniform(const UniformName name_) const noexcept
+    {
+        return FindUniform(name_.hash);
+    }
+
+    /**
+     * @brief 유니폼 변수를 설정합니다. 마지막으로 설정한 값과 같다면 GL을 호출하지 않습니다.
+     *
+     * @param handle_ 유니폼 변수 핸들
+     * @param value_  설정할 값
+     */
+    inline void SetUniform(const UniformHandle handle_, const int value_) noexcept
+    {
+        if (Store(handle_, value_))
+        {
+            glProgramUniform1i(programID, uniforms[handle_].location, value_);
+        }
+    }
+
+    inline void SetUniform(const UniformHandle handle_, const float value_) noexcept
+    {
+        if (Store(handle_, value_))
+        {
+            glProgramUniform1f(programID, uniforms[handle_].location, value_);
+        }
+    }
+
+    inline void SetUniform(const UniformHandle handle_, const glm::fvec2& value_) noexcept
+    {
+        if (Store(handle_, value_))
+        {
+            glProgramUniform2fv(programID, uniforms[handle_].location, 1, glm::value_ptr(value_));
+        }
+    }
+
+    inline void SetUniform(const UniformHandle handle_, const glm::fvec3& value_) noexcept
+    {
+        if (Store(handle_, value_))
+        {
+            glProgramUniform3fv(programID, uniforms[handle_].location, 1, glm::value_ptr(value_));
+        }
+    }
+
+    inline void SetUniform(const UniformHandle handle_, const glm::fvec4& value_) noexcept
+    {
+        if (Store(handle_, value_))
+        {
+            glProgramUniform4fv(programID, uniforms[handle_].location, 1, glm::value_ptr(value_));
+        }
+    }
+
+    inline void SetUniform(const UniformHandle handle_, const glm::fmat4x4& value_) noexcept
+    {
+        if (Store(handle_, value_))
+        {
+            glProgramUniformMatrix4fv(programID, uniforms[handle_].location, 1, GL_FALSE, glm::value_ptr(value_));
+        }
+    }
+
     /**
      * @brief 정수형 유니폼 변수를 설정합니다.
      *
      * @param name_  유니폼 변수 이름
      * @param value_ 설정할 값
      */
-    inline void SetUniformInt(const char* const name_, const int value_) noexcept
+    inline void SetUniformInt(const UniformName name_, const int value_) noexcept
     {
-        const GLint location = glGetUniformLocation(programID, name_);
-        glUniform1i(location, value_);
+        SetUniform(FindUniform(name_), value_);
     }
 
     /**
@@ -296,10 +522,9 @@ class Shader : public Resource
      * @param name_  유니폼 변수 이름
      * @param value_ 설정할 값
      */
-    inline void SetUniformFloat(const char* const name_, const float value_) noexcept
+    inline void SetUniformFloat(const UniformName name_, const float value_) noexcept
     {
-        const GLint location = glGetUniformLocation(programID, name_);
-        glUniform1f(location, value_);
+        SetUniform(FindUniform(name_), value_);
     }
 
     /**
@@ -308,10 +533,9 @@ class Shader : public Resource
      * @param name_  유니폼 변수 이름
      * @param value_ 설정할 값
      */
-    inline void SetUniformVector2(const char* const name_, const glm::fvec3& value_) noexcept
+    inline void SetUniformVector2(const UniformName name_, const glm::fvec2& value_) noexcept
     {
-        const GLint location = glGetUniformLocation(programID, name_);
-        glUniform2fv(location, 1, glm::value_ptr(value_));
+        SetUniform(FindUniform(name_), value_);
     }
 
     /**
@@ -320,10 +544,9 @@ class Shader : public Resource
      * @param name_  유니폼 변수 이름
      * @param value_ 설정할 값
      */
-    inline void SetUniformVector3(const char* const name_, const glm::fvec3& value_) noexcept
+    inline void SetUniformVector3(const UniformName name_, const glm::fvec3& value_) noexcept
     {
-        const GLint location = glGetUniformLocation(programID, name_);
-        glUniform3fv(location, 1, glm::value_ptr(value_));
+        SetUniform(FindUniform(name_), value_);
     }
 
     /**
@@ -332,10 +555,9 @@ class Shader : public Resource
      * @param name_  유니폼 변수 이름
      * @param value_ 설정할 값
      */
-    inline void SetUniformVector4(const char* const name_, const glm::vec4& value_) noexcept
+    inline void SetUniformVector4(const UniformName name_, const glm::vec4& value_) noexcept
     {
-        const GLint location = glGetUniformLocation(programID, name_);
-        glUniform4fv(location, 1, glm::value_ptr(value_));
+        SetUniform(FindUniform(name_), value_);
     }
 
     /**
@@ -344,10 +566,28 @@ class Shader : public Resource
      * @param name_  유니폼 변수 이름
      * @param value_ 설정할 값
      */
-    inline void SetUniformMatrix4x4(const char* const name_, const glm::mat4& value_) noexcept
+    inline void SetUniformMatrix4x4(const UniformName name_, const glm::mat4& value_) noexcept
+    {
+        SetUniform(FindUniform(name_), value_);
+    }
+
+    /**
+     * @brief 지난 초기화 이후의 유니폼 변수 설정 통계를 반환합니다.
+     *
+     * @return const UniformStatistics& 유니폼 변수 설정 통계
+     */
+    [[nodiscard]]
+    static inline const UniformStatistics& GetStatistics() noexcept
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief 유니폼 변수 설정 통계를 초기화합니다. 매 프레임 시작 시 호출됩니다.
+     */
+    static inline void ResetStatistics() noexcept
     {
-        const GLint location = glGetUniformLocation(programID, name_);
-        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value_));
+        statistics = UniformStatistics();
     }
 
 protected:
@@ -371,101 +611,780 @@ class Shader : public Resource
     static unsigned int Compile(unsigned int type_, std::string_view source_) noexcept;
 
     /**
-     * @brief 셰이더 프로그램 ID.
+     * @brief 링크된 프로그램의 활성 유니폼 변수들을 조회하여 테이블을 만들고,
+     *        프레임 상수 블록을 선언했다면 FrameBlockBinding에 연결합니다.
      */
-    unsigned int programID;
-};
+    void Reflect() noexcept;
 
-class Mesh final : public Resource
-{
-public:
     /**
-     * @struct Vertex
+     * @brief 지정한 해시를 가진 유니폼 변수 핸들을 찾습니다.
      *
-     * @brief 정점 데이터를 정의합니다.
+     * @param hash_ 유니폼 변수 이름의 해시
+     *
+     * @return UniformHandle 유니폼 변수 핸들. 없다면 InvalidUniform
      */
-    struct Vertex final
+    [[nodiscard]]
+    inline UniformHandle FindUniform(const std::uint32_t hash_) const noexcept
+    {
+        // 셰이더 하나의 유니폼 변수는 많지 않으므로 연속된 테이블을 순차 탐색합니다.
+        for (UniformHandle handle = 0; handle < uniforms.size(); ++handle)
+        {
+            if (uniforms[handle].hash == hash_)
+            {
+                return handle;
+            }
+        }
+
+        return InvalidUniform;
+    }
+
+    /**
+     * @brief 설정할 값을 유니폼 변수의 마지막 값과 비교하여 저장합니다.
+     *
+     * @tparam TValue 설정할 값의 타입
+     *
+     * @param handle_ 유니폼 변수 핸들
+     * @param value_  설정할 값
+     *
+     * @return bool GL을 호출하여 값을 올려야 하는지 여부
+     */
+    template <typename TValue>
+    [[nodiscard]]
+    inline bool Store(const UniformHandle handle_, const TValue& value_) noexcept
+    {
+        static_assert(sizeof(TValue) <= sizeof(glm::fmat4x4), "Uniform value is too large to shadow.");
+
+        // 핸들을 통해 접근하므로 glGetUniformLocation은 항상 생략됩니다.
+        ++statistics.avoidedCallCount;
+
+        if (handle_ >= uniforms.size())
+        {
+            return false;
+        }
+
+        Uniform& uniform = uniforms[handle_];
+        if (uniform.hasValue && std::memcmp(uniform.value.data(), &value_, sizeof(TValue)) == 0)
+        {
+            ++statistics.avoidedCallCount;
+            return false;
+        }
+
+        std::memcpy(uniform.value.data(), &value_, sizeof(TValue));
+        uniform.hasValue = true;
+
+        ++statistics.issuedCallCount;
+        return true;
+    }
+
+    /**
+     * @struct Uniform
+     *
+     * @brief 리플렉션으로 조회한 활성 유니폼 변수를 정의합니다.
+     */
+    struct Uniform
     {
         /**
-         * @brief 정점의 위치.
+         * @brief 유니폼 변수 이름의 해시.
          */
-        glm::vec3 position;
+        std::uint32_t hash;
 
         /**
-         * @brief 정점의 법선 벡터.
+         * @brief 유니폼 변수의 위치.
          */
-        glm::vec3 normal;
+        GLint location;
 
         /**
-         * @brief 정점의 텍스처 좌표.
+         * @brief 유니폼 변수의 GL 타입.
          */
-        glm::vec2 texCoords;
+        GLenum type;
+
+        /**
+         * @brief 배열이라면 원소의 개수, 아니라면 1.
+         */
+        GLint count;
+
+        /**
+         * @brief 값이 한 번이라도 설정되었는지 여부.
+         */
+        bool hasValue;
+
+        /**
+         * @brief 마지막으로 설정한 값.
+         */
+        std::array<std::byte, sizeof(glm::fmat4x4)> value;
     };
 
     /**
-     * @brief 생성자.
+     * @brief 셰이더 프로그램 ID.
      */
-    Mesh() noexcept;
+    unsigned int programID;
 
     /**
-     * @brief 소멸자.
+     * @brief 활성 유니폼 변수들의 테이블.
      */
-    virtual ~Mesh() noexcept override;
+    std::vector<Uniform> uniforms;
 
     /**
-     * @brief 메쉬를 바인딩합니다.
+     * @brief 유니폼 변수 설정 통계.
      */
-    void Draw() noexcept;
+    static inline UniformStatistics statistics;
+};
 
-protected:
+/**
+ * @struct Bounds
+ *
+ * @brief 메쉬의 로컬 공간 경계 상자와 경계 구를 정의합니다.
+ */
+struct Bounds
+{
     /**
-     * @brief 머티리얼을 로드합니다.
-     *
-     * @param path_ 머티리얼 이름
-     *
-     * @return bool 머티리얼 로드 성공 여부
+     * @brief 경계 상자와 경계 구의 중심.
      */
-    virtual bool Load(const std::filesystem::path& path_) noexcept override;
+    glm::fvec3 center = glm::fvec3(0.0f);
 
-private:
     /**
-     * @brief 정점 배열 객체.
+     * @brief 경계 상자의 중심에서 각 축 방향 면까지의 거리.
      */
-    unsigned int vao;
+    glm::fvec3 extents = glm::fvec3(0.0f);
 
     /**
-     * @brief 정점 버퍼 객체.
+     * @brief 경계 구의 반지름.
      */
-    unsigned int vbo;
+    float radius = 0.0f;
+};
 
+/**
+ * @struct DrawStatistics
+ *
+ * @brief 한 프레임 동안의 드로우 콜 통계를 정의합니다.
+ */
+struct DrawStatistics
+{
     /**
-     * @brief 요소 배열 객체.
+     * @brief 실제로 호출한 드로우 콜의 개수.
      */
-    unsigned int ebo;
+    std::size_t drawCallCount = 0;
 
     /**
-     * @brief
+     * @brief 인스턴싱으로 호출한 드로우 콜의 개수.
      */
-    std::vector<Mesh::Vertex> vertices;
+    std::size_t instancedDrawCallCount = 0;
 
     /**
-     * @brief
+     * @brief 그린 인스턴스의 개수. 인스턴싱을 사용하지 않았다면 필요했을 드로우 콜의 개수와 같습니다.
      */
-    std::vector<unsigned int> indices;
-};
+    std::size_t instanceCount = 0;
 
-class AudioClip : public Resource
-{
-public:
     /**
-     * @brief 생성자.
+     * @brief 그린 삼각형의 개수. 인스턴스마다 선택된 LOD의 삼각형을 셉니다.
      */
-    explicit AudioClip() noexcept;
+    std::size_t triangleCount = 0;
+};
 
+class Mesh final : public Resource
+{
+public:
     /**
-     * @brief 생성자.
+     * @struct Vertex
+     *
+     * @brief 정점 데이터를 정의합니다.
      */
-    virtual ~AudioClip() noexcept override;
+    struct Vertex final
+    {
+        /**
+         * @brief 정점의 위치.
+         */
+        glm::vec3 position;
+
+        /**
+         * @brief 정점의 법선 벡터.
+         */
+        glm::vec3 normal;
+
+        /**
+         * @brief 정점의 텍스처 좌표.
+         */
+        glm::vec2 texCoords;
+    };
+
+    /**
+     * @enum VertexFormat
+     *
+     * @brief GPU에 올리는 정점 버퍼의 배치를 정의합니다. CPU에 보관하는 정점(Vertex)은 형식과 관계없이 항상 float입니다.
+     */
+    enum class VertexFormat : std::uint8_t
+    {
+        /**
+         * @brief 모든 속성을 float로 담습니다. (32바이트)
+         */
+        Float,
+
+        /**
+         * @brief 위치는 float, 법선은 GL_INT_2_10_10_10_REV, 텍스처 좌표는 half float로 담습니다. (20바이트)
+         */
+        Packed,
+
+        /**
+         * @brief Packed에서 위치를 메쉬 경계 상자 기준의 정규화된 16비트 정수로 담습니다. (16바이트)
+         *
+         * @details 셰이더는 positionScale, positionOffset 유니폼으로 위치를 복원해야 합니다.
+         */
+        Quantized
+    };
+
+    /**
+     * @struct PackedVertex
+     *
+     * @brief VertexFormat::Packed의 정점 데이터를 정의합니다.
+     */
+    struct PackedVertex final
+    {
+        /**
+         * @brief 정점의 위치.
+         */
+        glm::vec3 position;
+
+        /**
+         * @brief 정규화된 부호 있는 10비트 정수 세 개로 묶은 법선 벡터.
+         */
+        std::uint32_t normal;
+
+        /**
+         * @brief half float 두 개로 묶은 텍스처 좌표.
+         */
+        std::uint32_t texCoords;
+    };
+
+    /**
+     * @struct QuantizedVertex
+     *
+     * @brief VertexFormat::Quantized의 정점 데이터를 정의합니다.
+     */
+    struct QuantizedVertex final
+    {
+        /**
+         * @brief 경계 상자 안의 상대 위치를 0 ~ 65535로 나타낸 위치. 네 번째 성분은 4바이트 정렬을 위한 여백입니다.
+         */
+        std::array<std::uint16_t, 4> position;
+
+        /**
+         * @brief 정규화된 부호 있는 10비트 정수 세 개로 묶은 법선 벡터.
+         */
+        std::uint32_t normal;
+
+        /**
+         * @brief half float 두 개로 묶은 텍스처 좌표.
+         */
+        std::uint32_t texCoords;
+    };
+
+    /**
+     * @struct InstanceData
+     *
+     * @brief 인스턴스 버퍼에 담기는 인스턴스별 데이터를 정의합니다.
+     */
+    struct InstanceData final
+    {
+        /**
+         * @brief 인스턴스의 모델 행렬.
+         */
+        glm::fmat4x4 model;
+
+        /**
+         * @brief 텍스처 배열에서 사용할 레이어(x). 나머지 성분은 16바이트 정렬을 위한 여백입니다.
+         */
+        glm::fvec4 textureLayer;
+    };
+
+    /**
+     * @struct Lod
+     *
+     * @brief 하나의 LOD가 요소 배열 객체에서 차지하는 범위를 정의합니다. 모든 LOD는 같은 정점 버퍼를 공유합니다.
+     */
+    struct Lod final
+    {
+        /**
+         * @brief 요소 배열 객체에서 해당 LOD가 시작하는 인덱스의 위치.
+         */
+        std::uint32_t firstIndex;
+
+        /**
+         * @brief 해당 LOD의 인덱스 개수.
+         */
+        std::uint32_t indexCount;
+    };
+
+    /**
+     * @brief 생성자.
+     */
+    Mesh() noexcept;
+
+    /**
+     * @brief 소멸자.
+     */
+    virtual ~Mesh() noexcept override;
+
+    /**
+     * @brief 인스턴스별 모델 행렬을 읽는 정점 속성의 시작 위치. mat4이므로 네 개의 위치를 차지합니다.
+     */
+    static constexpr unsigned int InstanceAttribute = 3;
+
+    /**
+     * @brief 인스턴스별 텍스처 배열 레이어를 읽는 정점 속성의 위치.
+     */
+    static constexpr unsigned int InstanceLayerAttribute = InstanceAttribute + 4;
+
+    /**
+     * @brief 원본(LOD 0)을 포함한 LOD의 최대 개수.
+     */
+    static constexpr std::size_t MaxLodCount = 4;
+
+    /**
+     * @brief 로드할 때 LOD를 만드는 최소 삼각형 수. 이보다 작은 메쉬는 줄여도 얻는 것이 거의 없습니다.
+     */
+    static constexpr std::size_t LodMinTriangleCount = 1024;
+
+    /**
+     * @brief 이전 LOD에 대한 다음 LOD의 목표 삼각형 비율.
+     */
+    static constexpr float LodReduction = 0.5f;
+
+    /**
+     * @brief 메쉬를 바인딩합니다.
+     */
+    void Draw() noexcept;
+
+    /**
+     * @brief 해당 메쉬의 정점 배열 객체를 바인딩합니다.
+     */
+    inline void Bind() const noexcept
+    {
+        GraphicsState::BindVertexArray(vao);
+    }
+
+    /**
+     * @brief 이미 바인딩된 해당 메쉬를 그립니다.
+     *
+     * @param lod_ 그릴 LOD. LOD 개수를 넘으면 가장 거친 LOD를 그립니다.
+     */
+    void Issue(std::uint32_t lod_ = 0) noexcept;
+
+    /**
+     * @brief 이미 바인딩된 해당 메쉬를 인스턴스 버퍼의 모델 행렬들을 사용하여 한 번의 드로우 콜로 여러 개 그립니다.
+     *
+     * @param instanceBuffer_ 인스턴스별 데이터(InstanceData)가 담긴 버퍼
+     * @param firstInstance_  버퍼에서 처음으로 사용할 인스턴스의 위치
+     * @param instanceCount_  그릴 인스턴스의 개수
+     * @param lod_            그릴 LOD. LOD 개수를 넘으면 가장 거친 LOD를 그립니다.
+     */
+    void IssueInstanced(unsigned int  instanceBuffer_,
+                        std::uint32_t firstInstance_,
+                        std::uint32_t instanceCount_,
+                        std::uint32_t lod_ = 0) noexcept;
+
+    /**
+     * @brief 해당 메쉬의 정점 배열 객체 ID를 반환합니다.
+     *
+     * @return unsigned int 정점 배열 객체 ID
+     */
+    [[nodiscard]]
+    inline unsigned int GetVertexArrayID() const noexcept
+    {
+        return vao;
+    }
+
+    /**
+     * @brief 정점과 인덱스로 메쉬를 만들어 GPU에 올립니다. 기존 데이터는 교체됩니다.
+     *
+     * @details 정점이 65536개 이하라면 인덱스를 16비트로 줄여서 올립니다. GetIndices()는 항상 32비트 인덱스를 반환합니다.
+     *
+     * @param vertices_ 정점들
+     * @param indices_  삼각형 목록의 인덱스들
+     *
+     * @return bool 생성 성공 여부
+     */
+    bool Build(std::vector<Vertex> vertices_, std::vector<unsigned int> indices_) noexcept;
+
+    /**
+     * @brief 이차 오차 행렬로 삼각형을 LodReduction만큼씩 줄여 가며 MaxLodCount개까지의 LOD 사슬을 만들고 GPU에 다시 올립니다.
+     *
+     * @details 각 LOD는 이전 LOD를 줄여 만들고, 더 줄지 않으면 거기서 멈춥니다. 기존 LOD는 교체됩니다.
+     *          Load는 LodMinTriangleCount 이상의 메쉬에 대해 자동으로 호출합니다.
+     */
+    void GenerateLods() noexcept;
+
+    /**
+     * @brief 원본(LOD 0)을 포함한 LOD의 개수를 반환합니다.
+     *
+     * @return std::uint32_t LOD의 개수
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetLodCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(lods.size());
+    }
+
+    /**
+     * @brief LOD의 삼각형 개수를 반환합니다.
+     *
+     * @param lod_ LOD
+     *
+     * @return std::size_t 삼각형의 개수. LOD가 없다면 0
+     */
+    [[nodiscard]]
+    inline std::size_t GetLodTriangleCount(const std::uint32_t lod_) const noexcept
+    {
+        return lod_ < lods.size() ? lods[lod_].indexCount / 3 : 0;
+    }
+
+    /**
+     * @brief GPU 정점 버퍼의 형식을 반환합니다.
+     *
+     * @return VertexFormat 정점 형식
+     */
+    [[nodiscard]]
+    inline VertexFormat GetVertexFormat() const noexcept
+    {
+        return vertexFormat;
+    }
+
+    /**
+     * @brief GPU 정점 버퍼의 형식을 바꿉니다. 이미 만든 메쉬라면 정점 버퍼를 새 형식으로 다시 올립니다.
+     *
+     * @details 정점이 많은 메쉬일수록 정점 읽기 대역폭과 GPU 메모리가 줄어듭니다.
+     *          디버그 빌드에서는 Float가 아닌 형식의 복원한 속성을 원본과 비교하여 허용 오차를 넘으면 경고합니다.
+     *
+     * @param vertexFormat_ 사용할 정점 형식
+     */
+    void SetVertexFormat(VertexFormat vertexFormat_) noexcept;
+
+    /**
+     * @brief 셰이더가 위치를 복원할 때 곱하는 값을 반환합니다. Quantized가 아니라면 (1, 1, 1)입니다.
+     *
+     * @return const glm::vec3& 위치 복원 배율
+     */
+    [[nodiscard]]
+    inline const glm::vec3& GetPositionScale() const noexcept
+    {
+        return positionScale;
+    }
+
+    /**
+     * @brief 셰이더가 위치를 복원할 때 더하는 값을 반환합니다. Quantized가 아니라면 (0, 0, 0)입니다.
+     *
+     * @return const glm::vec3& 위치 복원 오프셋
+     */
+    [[nodiscard]]
+    inline const glm::vec3& GetPositionOffset() const noexcept
+    {
+        return positionOffset;
+    }
+
+    /**
+     * @brief 해당 메쉬의 정점들을 반환합니다.
+     *
+     * @return const std::vector<Vertex>& 정점들
+     */
+    [[nodiscard]]
+    inline const std::vector<Vertex>& GetVertices() const noexcept
+    {
+        return vertices;
+    }
+
+    /**
+     * @brief 해당 메쉬의 원본(LOD 0) 삼각형 목록 인덱스들을 반환합니다.
+     *
+     * @return const std::vector<unsigned int>& 인덱스들
+     */
+    [[nodiscard]]
+    inline const std::vector<unsigned int>& GetIndices() const noexcept
+    {
+        return indices;
+    }
+
+    /**
+     * @brief 해당 메쉬의 로컬 공간 경계를 반환합니다.
+     *
+     * @return const Bounds& 로컬 공간 경계
+     */
+    [[nodiscard]]
+    inline const Bounds& GetBounds() const noexcept
+    {
+        return bounds;
+    }
+
+    /**
+     * @brief 지난 초기화 이후의 드로우 콜 통계를 반환합니다.
+     *
+     * @return const DrawStatistics& 드로우 콜 통계
+     */
+    [[nodiscard]]
+    static inline const DrawStatistics& GetStatistics() noexcept
+    {
+        return statistics;
+    }
+
+    /**
+     * @brief 드로우 콜 통계를 초기화합니다. 매 프레임 시작 시 호출됩니다.
+     */
+    static inline void ResetStatistics() noexcept
+    {
+        statistics = DrawStatistics();
+    }
+
+protected:
+    /**
+     * @brief 머티리얼을 로드합니다.
+     *
+     * @param path_ 머티리얼 이름
+     *
+     * @return bool 머티리얼 로드 성공 여부
+     */
+    virtual bool Load(const std::filesystem::path& path_) noexcept override;
+
+private:
+    /**
+     * @brief 보관한 정점과 인덱스를 현재 정점 형식으로 GPU에 올리고 정점 속성을 설정합니다.
+     */
+    void Upload() noexcept;
+
+    /**
+     * @brief 정점 배열 객체.
+     */
+    unsigned int vao;
+
+    /**
+     * @brief 정점 버퍼 객체.
+     */
+    unsigned int vbo;
+
+    /**
+     * @brief 요소 배열 객체.
+     */
+    unsigned int ebo;
+
+    /**
+     * @brief 요소 배열 객체에 올린 인덱스의 자료형. 정점이 65536개 이하라면 GL_UNSIGNED_SHORT, 아니라면 GL_UNSIGNED_INT입니다.
+     */
+    unsigned int indexType;
+
+    /**
+     * @brief GPU 정점 버퍼의 형식.
+     */
+    VertexFormat vertexFormat;
+
+    /**
+     * @brief 위치 복원 배율.
+     */
+    glm::vec3 positionScale;
+
+    /**
+     * @brief 위치 복원 오프셋.
+     */
+    glm::vec3 positionOffset;
+
+    /**
+     * @brief
+     */
+    std::vector<Mesh::Vertex> vertices;
+
+    /**
+     * @brief
+     */
+    std::vector<unsigned int> indices;
+
+    /**
+     * @brief LOD 1부터 차례로 이어 붙인 인덱스들. 요소 배열 객체에는 indices 뒤에 올라갑니다.
+     */
+    std::vector<unsigned int> lodIndices;
+
+    /**
+     * @brief LOD별 인덱스 범위. 첫 번째는 항상 원본입니다.
+     */
+    std::vector<Lod> lods;
+
+    /**
+     * @brief 로컬 공간 경계.
+     */
+    Bounds bounds;
+
+    /**
+     * @brief 드로우 콜 통계.
+     */
+    static inline DrawStatistics statistics;
+};
+
+/**
+ * @class MeshBuilder
+ *
+ * @brief 여러 메쉬를 변환하여 하나의 정점/인덱스 버퍼로 합칩니다.
+ *
+ * @details 움직이지 않는 많은 오브젝트를 한 번의 드로우 콜로 그리기 위해 로드 시점에 사용합니다.
+ *          축에 정렬된 면 단위로 삼각형을 제외할 수 있어, 서로 맞닿아 보이지 않는 면을 굽기 전에 제거할 수 있습니다.
+ */
+class MeshBuilder final
+{
+public:
+    /**
+     * @brief 삼각형이 바라보는 축 방향을 나타내는 비트 플래그를 정의합니다.
+     */
+    enum Face : std::uint8_t
+    {
+        PositiveX = 1 << 0,
+        NegativeX = 1 << 1,
+        PositiveY = 1 << 2,
+        NegativeY = 1 << 3,
+        PositiveZ = 1 << 4,
+        NegativeZ = 1 << 5,
+        AllFaces  = 0x3F
+    };
+
+    /**
+     * @brief 메쉬를 변환하여 추가합니다.
+     *
+     * @details 법선은 Standard 셰이더와 같이 변환 행렬의 3x3 부분으로 변환하므로,
+     *          합친 메쉬를 단위 행렬로 그리면 원래 메쉬를 각각 그린 것과 같은 결과가 됩니다.
+     *
+     * @param mesh_      추가할 메쉬
+     * @param transform_ 메쉬에 적용할 변환 행렬
+     * @param faces_     추가할 면들. 기하 법선의 주축이 포함되지 않은 삼각형은 제외됩니다.
+     */
+    void Append(const Mesh& mesh_, const glm::fmat4x4& transform_, std::uint8_t faces_ = AllFaces) noexcept;
+
+    /**
+     * @brief 지금까지 추가한 삼각형으로 새 메쉬를 만들고 빌더를 비웁니다.
+     *
+     * @param vertexFormat_ 만든 메쉬의 정점 형식. GPU에는 이 형식으로 한 번만 올립니다.
+     *
+     * @return std::unique_ptr<Mesh> 만든 메쉬. 추가한 삼각형이 없다면 nullptr
+     */
+    [[nodiscard]]
+    std::unique_ptr<Mesh> Build(Mesh::VertexFormat vertexFormat_ = Mesh::VertexFormat::Float) noexcept;
+
+    /**
+     * @brief 지금까지 추가한 삼각형의 개수를 반환합니다.
+     *
+     * @return std::size_t 삼각형의 개수
+     */
+    [[nodiscard]]
+    inline std::size_t GetTriangleCount() const noexcept
+    {
+        return indices.size() / 3;
+    }
+
+private:
+    /**
+     * @brief 합친 정점들.
+     */
+    std::vector<Mesh::Vertex> vertices;
+
+    /**
+     * @brief 합친 인덱스들.
+     */
+    std::vector<unsigned int> indices;
+
+    /**
+     * @brief Append에서 원본 정점 인덱스를 합친 정점 인덱스로 바꾸는 데 사용하는 임시 테이블.
+     */
+    std::vector<unsigned int> remap;
+};
+
+/**
+ * @class MeshOptimizer
+ *
+ * @brief 삼각형 목록 메쉬의 정점 재사용과 정점 캐시 효율을 높이는 로드 시점 최적화들을 정의합니다.
+ */
+class MeshOptimizer final
+{
+    STATIC_CLASS(MeshOptimizer)
+
+public:
+    /**
+     * @brief 정점 캐시 최적화가 점수를 매길 때 가정하는 LRU 캐시의 크기.
+     */
+    static constexpr std::size_t OptimizerCacheSize = 32;
+
+    /**
+     * @brief 평균 캐시 미스 비율(ACMR)을 계산할 때 흉내 내는 FIFO 캐시의 크기.
+     */
+    static constexpr std::size_t SimulatedCacheSize = 16;
+
+    /**
+     * @brief 위치, 법선, 텍스처 좌표가 모두 같은 정점들을 하나로 합치고 인덱스를 다시 씁니다.
+     *
+     * @details 합친 정점들은 처음 나타난 순서를 유지합니다. 0.0과 -0.0은 같은 값으로 취급합니다.
+     *
+     * @param vertices_ 합칠 정점들
+     * @param indices_  정점들을 가리키는 삼각형 목록 인덱스들
+     */
+    static void WeldVertices(std::vector<Mesh::Vertex>& vertices_, std::vector<unsigned int>& indices_) noexcept;
+
+    /**
+     * @brief 정점 캐시 적중이 많아지도록 삼각형의 순서를 바꿉니다.
+     *
+     * @details Tom Forsyth의 선형 시간 정점 캐시 최적화를 사용합니다.
+     *          캐시에 있는 정점과 남은 삼각형이 적은 정점에 높은 점수를 주고, 매번 정점 점수의 합이 가장 큰 삼각형을 내보냅니다.
+     *
+     * @param indices_     삼각형 목록 인덱스들
+     * @param vertexCount_ 정점의 개수
+     */
+    static void OptimizeVertexCache(std::vector<unsigned int>& indices_, std::size_t vertexCount_) noexcept;
+
+    /**
+     * @brief 정점들을 인덱스에서 처음 사용되는 순서로 재배치하여 정점 읽기의 메모리 지역성을 높입니다. 사용되지 않는 정점은 제거됩니다.
+     *
+     * @param vertices_ 재배치할 정점들
+     * @param indices_  정점들을 가리키는 삼각형 목록 인덱스들
+     */
+    static void OptimizeVertexFetch(std::vector<Mesh::Vertex>& vertices_, std::vector<unsigned int>& indices_) noexcept;
+
+    /**
+     * @brief FIFO 정점 캐시를 흉내 내어 삼각형당 평균 캐시 미스 횟수(ACMR)를 계산합니다.
+     *
+     * @details 정점을 공유하지 않는 메쉬는 3.0이며, 낮을수록 정점 셰이더 호출이 적습니다.
+     *
+     * @param indices_     삼각형 목록 인덱스들
+     * @param vertexCount_ 정점의 개수
+     * @param cacheSize_   흉내 낼 캐시의 크기
+     *
+     * @return float 평균 캐시 미스 비율. 삼각형이 없다면 0
+     */
+    [[nodiscard]]
+    static float ComputeAcmr(const std::vector<unsigned int>& indices_,
+                             std::size_t                      vertexCount_,
+                             std::size_t                      cacheSize_ = SimulatedCacheSize) noexcept;
+
+    /**
+     * @brief 이차 오차 행렬(Garland-Heckbert)로 비용이 낮은 모서리부터 접어 삼각형 수를 줄인 인덱스를 만듭니다.
+     *
+     * @details 정점은 이웃 정점으로 옮겨지기만 하므로 결과는 원래 정점들을 그대로 가리키며, 모든 LOD가 하나의 정점 버퍼를 공유할 수 있습니다.
+     *          텍스처 좌표가 나뉘는 이음매와 열린 경계의 정점은 움직이지 않고, 삼각형이 뒤집히는 접기는 건너뜁니다.
+     *          따라서 이음매와 경계가 많은 메쉬는 목표에 도달하지 못할 수 있습니다.
+     *
+     * @param vertices_         정점들
+     * @param indices_          줄일 삼각형 목록 인덱스들
+     * @param targetIndexCount_ 목표 인덱스 개수
+     *
+     * @return std::vector<unsigned int> 줄인 삼각형 목록 인덱스들
+     */
+    [[nodiscard]]
+    static std::vector<unsigned int> Simplify(const std::vector<Mesh::Vertex>& vertices_,
+                                              const std::vector<unsigned int>& indices_,
+                                              std::size_t                      targetIndexCount_) noexcept;
+};
+
+class AudioClip : public Resource
+{
+public:
+    /**
+     * @brief 생성자.
+     */
+    explicit AudioClip() noexcept;
+
+    /**
+     * @brief 생성자.
+     */
+    virtual ~AudioClip() noexcept override;
 
     /**
      * @brief 버퍼 ID를 반환합니다.
@@ -538,15 +1457,111 @@ class ResourceManager final
         auto it = resources.find(path_);
         if (it == resources.end())
         {
-            return GetResource<TResource>(path_);
+            return nullptr;
         }
 
         return dynamic_cast<TResource*>(it->second.get());
     }
 
+    /**
+     * @brief 파일이 아닌 코드에서 만든 리소스를 지정한 가상 경로로 등록합니다. 같은 경로의 리소스는 교체됩니다.
+     *
+     * @tparam TResource 등록할 리소스의 타입
+     *
+     * @param path_     리소스를 찾을 때 사용할 가상 경로
+     * @param resource_ 등록할 리소스
+     *
+     * @return TResource* 등록한 리소스
+     */
+    template <IsResource TResource>
+    static TResource* AddResource(const std::filesystem::path& path_, std::unique_ptr<TResource> resource_)
+    {
+        TResource* const result = resource_.get();
+        if (!result)
+        {
+            return nullptr;
+        }
+
+        result->SetPath(path_);
+        resources.insert_or_assign(path_, std::move(resource_));
+
+        return result;
+    }
+
 private:
     /**
      * @brief 게임 내 사용할 리소스들.
      */
     static std::unordered_map<std::filesystem::path, std::unique_ptr<Resource>> resources;
-};
\ No newline at end of file
+};
+
+/**
+ * @class TextureArrayBuilder
+ *
+ * @brief 이미지들을 로드 시점에 하나의 TextureArray로 묶습니다.
+ *
+ * @details 모든 이미지는 RGBA8로 변환되고, 크기가 다르다면 레이어 크기로 선형 보간하여 맞춥니다.
+ *          같은 경로를 다시 추가하면 기존 레이어를 반환합니다.
+ */
+class TextureArrayBuilder final
+{
+public:
+    /**
+     * @brief 생성자.
+     *
+     * @param width_  레이어의 너비
+     * @param height_ 레이어의 높이
+     */
+    TextureArrayBuilder(int width_, int height_) noexcept;
+
+    /**
+     * @brief 이미지를 새 레이어로 추가합니다.
+     *
+     * @details 이미지를 읽지 못하면 오류를 기록하고 불투명한 검은색 레이어를 추가하여, 레이어 번호가 추가한 순서와 항상 같도록 합니다.
+     *
+     * @param path_ 이미지 경로
+     *
+     * @return std::uint32_t 이미지가 담긴 레이어
+     */
+    std::uint32_t Add(const std::filesystem::path& path_) noexcept;
+
+    /**
+     * @brief 지금까지 추가된 레이어의 개수를 반환합니다.
+     *
+     * @return std::uint32_t 레이어의 개수
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetLayerCount() const noexcept
+    {
+        return static_cast<std::uint32_t>(layers.size());
+    }
+
+    /**
+     * @brief 추가된 레이어들로 밉맵이 있는 텍스처 배열을 만들어 GPU에 올립니다.
+     *
+     * @return std::unique_ptr<TextureArray> 만든 텍스처 배열. 레이어가 없다면 nullptr
+     */
+    [[nodiscard]]
+    std::unique_ptr<TextureArray> Build() noexcept;
+
+private:
+    /**
+     * @brief 레이어의 너비.
+     */
+    int width;
+
+    /**
+     * @brief 레이어의 높이.
+     */
+    int height;
+
+    /**
+     * @brief 레이어 순서대로 나열한 원본 이미지 경로들.
+     */
+    std::vector<std::string> layers;
+
+    /**
+     * @brief 모든 레이어의 RGBA8 픽셀들.
+     */
+    std::vector<std::uint8_t> pixels;
+};
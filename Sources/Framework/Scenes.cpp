@@ -2,6 +2,7 @@
 
 #include "Application.h"
 #include "Debug.h"
+#include "Jobs.h"
 #include "Objects.h"
 #include "Rendering.h"
 #include "Time.h"
@@ -12,105 +13,809 @@ Scene::~Scene() noexcept
 
 void Scene::Enter() noexcept
 {
+    const PoolStatistics before = PoolManager::GetStatistics();
+
     OnEnter();
+
+    const PoolStatistics& after = PoolManager::GetStatistics();
+    Logger::Info("Scene entered: {} pooled allocations, {} chunk allocations ({} bytes).",
+                 after.allocationCount - before.allocationCount,
+                 after.chunkCount - before.chunkCount,
+                 after.chunkBytes - before.chunkBytes);
+    Logger::Info("Scene objects: {} static, {} dynamic.", GetStaticObjectCount(), GetDynamicObjectCount());
 }
 
 void Scene::Update() noexcept
 {
-    for (const std::unique_ptr<Object>& entity : objects)
+    StartPendingComponents();
+
+    // 병렬로 갱신되는 컴포넌트들은 등록 순서와 관계없이 메인 스레드의 Update들보다 먼저 갱신됩니다.
+    const auto parallelUpdateStart = std::chrono::steady_clock::now();
+    UpdateParallelComponents();
+    parallelUpdateTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - parallelUpdateStart).count();
+
+    // 이번 프레임에 새로 등록된 컴포넌트는 다음 프레임부터 갱신됩니다.
+    for (std::size_t index = 0, count = updateComponents.size(); index < count; ++index)
     {
-        entity->Update();
+        Component* const component = updateComponents[index];
+        if (component->isStarted && CanInvoke(component))
+        {
+            component->Update();
+        }
+    }
+
+    for (std::size_t index = 0, count = lateUpdateComponents.size(); index < count; ++index)
+    {
+        Component* const component = lateUpdateComponents[index];
+        if (component->isStarted && CanInvoke(component))
+        {
+            component->LateUpdate();
+        }
     }
 
     OnUpdate();
+
+    TransformManager::UpdateWorldMatrices();
 }
 
 void Scene::FixedUpdate() noexcept
 {
-    for (const std::unique_ptr<Object>& object : objects)
+    for (std::size_t index = 0, count = fixedUpdateComponents.size(); index < count; ++index)
     {
-        object->FixedUpdate();
+        Component* const component = fixedUpdateComponents[index];
+        if (component->isStarted && CanInvoke(component))
+        {
+            component->FixedUpdate();
+        }
     }
 
-    std::erase_if(objects, [](const std::unique_ptr<Object>& object) { return object->IsDestroyed(); });
-
     OnFixedUpdate();
 }
 
 void Scene::Render() noexcept
 {
-    std::vector<Camera*> cameras;
+    std::vector<Camera*> activeCameras;
 
-    for (const std::unique_ptr<Object>& object : objects)
+    for (Camera* const camera : cameras)
     {
-        if (!object->IsEnabled())
+        if (CanInvoke(camera))
         {
-            continue;
-        }
-
-        if (Camera* camera = object->GetComponent<Camera>())
-        {
-            if (camera->IsEnabled())
-            {
-                cameras.push_back(camera);
-            }
+            activeCameras.push_back(camera);
         }
     }
 
-    if (cameras.empty())
+    if (activeCameras.empty())
     {
         Logger::Warn("No active camera found in the scene. Skipping rendering.");
         return;
     }
 
-    for (Camera* camera : cameras)
+    // 렌더링 순서가 같은 카메라들은 추가된 순서를 유지합니다.
+    std::stable_sort(activeCameras.begin(), activeCameras.end(), [](const Camera* const lhs, const Camera* const rhs) {
+        return lhs->GetRenderOrder() < rhs->GetRenderOrder();
+    });
+
+    if (isRenderBucketDirty || isStaticBucketDirty)
     {
-        camera->Ready();
+        if (isRenderBucketDirty)
+        {
+            RebuildRenderBuckets(renderComponents, renderBuckets);
+            isRenderBucketDirty = false;
+        }
 
-        for (const std::unique_ptr<Object>& object : objects)
+        if (isStaticBucketDirty)
         {
-            if (object->IsEnabled())
-            {
-                object->Render();
-            }
+            RebuildRenderBuckets(staticRenderComponents, staticRenderBuckets);
+            isStaticBucketDirty = false;
+
+            Logger::Info("Static render buckets rebuilt: {} renderers in {} buckets.",
+                         staticRenderComponents.size(),
+                         staticRenderBuckets.size());
         }
     }
 
+    cullingStatistics = CullingStatistics();
+
+    // 조명은 모든 카메라 패스가 공유하므로 한 번만 모아 두고, 각 카메라의 Ready에서 함께 업로드합니다.
+    std::vector<const Light*> activeLights;
+    for (Object* const owner : FindAllWithComponent<Light>())
+    {
+        const Light* const light = owner->GetComponent<Light>();
+        if (CanInvoke(light))
+        {
+            activeLights.push_back(light);
+        }
+    }
+    FrameConstants::SetLights(activeLights);
+
+    for (Camera* camera : activeCameras)
+    {
+        // 인스턴스 버퍼는 카메라마다 그리는 레이어와 절두체 안의 인스턴스만 모아 다시 채웁니다.
+        const ScreenProjection screenProjection = camera->GetScreenProjection();
+        const Frustum          frustum          = Frustum::FromMatrix(screenProjection.viewProjection);
+        const std::uint32_t    cullingMask      = camera->GetCullingMask();
+        UploadInstances(frustum, screenProjection, cullingMask);
+
+        camera->Ready();
+
+        RenderQueue::Begin(camera->GetViewMatrix(), camera->GetNearPlane(), camera->GetFarPlane());
+        SubmitBuckets(renderBuckets, frustum, screenProjection, cullingMask);
+        SubmitBuckets(staticRenderBuckets, frustum, screenProjection, cullingMask);
+        RenderQueue::Execute();
+    }
+
     OnRender();
+
+    if (!isDrawStatisticsLogged)
+    {
+        const DrawStatistics&          statistics        = Mesh::GetStatistics();
+        const GraphicsStateStatistics& stateStatistics   = GraphicsState::GetStatistics();
+        const UniformStatistics&       uniformStatistics = Shader::GetStatistics();
+        Logger::Info("Scene first frame: {} draw calls ({} instanced) for {} instances, {} triangles, {} state changes ({} elided), "
+                     "{} uniform uploads ({} GL calls avoided), {} frame constant uploads.",
+                     statistics.drawCallCount,
+                     statistics.instancedDrawCallCount,
+                     statistics.instanceCount,
+                     statistics.triangleCount,
+                     stateStatistics.issuedCount,
+                     stateStatistics.elidedCount,
+                     uniformStatistics.issuedCallCount,
+                     uniformStatistics.avoidedCallCount,
+                     FrameConstants::GetUploadCount());
+        Logger::Info("Scene first frame culling: {} renderers drawn, {} culled, {} skipped by camera culling masks.",
+                     cullingStatistics.drawnCount,
+                     cullingStatistics.culledCount,
+                     cullingStatistics.maskedCount);
+
+        isDrawStatisticsLogged = true;
+    }
 }
 
 void Scene::RenderUI() noexcept
 {
-    for (const std::unique_ptr<Object>& object : uiObjects)
+    // 카메라마다 자신의 뷰포트를 설정하므로, UI와 이후의 페이드는 화면 전체 뷰포트로 되돌린 뒤 그립니다.
+    glViewport(0, 0, Application::GetWindowWidth(), Application::GetWindowHeight());
+
+    // UI는 화면 좌표계이므로 z 값 [-1, 1]을 그대로 깊이로 사용합니다.
+    RenderQueue::Begin(glm::fmat4x4(1.0f), -1.0f, 1.0f);
+
+    for (Component* const component : uiRenderComponents)
     {
-        if (!object->IsEnabled())
+        if (CanInvoke(component))
         {
-            continue;
+            component->Render();
         }
-
-        object->Render();
     }
 
+    RenderQueue::Execute();
+
     // 3. 씬 별 추가 커스텀 UI 로직 호출
     OnRenderUI();
 }
 
 void Scene::Exit() noexcept
 {
+    pendingStartComponents.clear();
+    updateComponents.clear();
+    parallelUpdateComponents.clear();
+    fixedUpdateComponents.clear();
+    lateUpdateComponents.clear();
+    renderComponents.clear();
+    renderBuckets.clear();
+    staticRenderComponents.clear();
+    staticRenderBuckets.clear();
+    instances.clear();
+    uiRenderComponents.clear();
+    cameras.clear();
+    tagIndex.clear();
+    for (std::vector<Object*>& owners : componentIndex)
+    {
+        owners.clear();
+    }
+    destroyedObjects.clear();
+    destroyedComponents.clear();
+    isRenderBucketDirty    = false;
+    isStaticBucketDirty    = false;
+    isDrawStatisticsLogged = false;
+    staticObjectCount      = 0;
+
+    GraphicsState::DeleteBuffer(instanceBuffer);
+
+    const PoolStatistics before = PoolManager::GetStatistics();
+
     objects.clear();
     uiObjects.clear();
 
+    const PoolStatistics& after = PoolManager::GetStatistics();
+    Logger::Info("Scene exited: {} pooled releases, {} slots still in use.",
+                 after.releaseCount - before.releaseCount,
+                 after.GetLiveCount());
+
     OnExit();
 }
 
 Object* Scene::AddGameObject(std::string_view name_, std::string_view tag_) noexcept
 {
-    return objects.emplace_back(std::make_unique<Object>(name_, tag_)).get();
+    return AddObject(objects, name_, tag_, false);
 }
 
 Object* Scene::AddUIObject(std::string_view name_, std::string_view tag_) noexcept
 {
-    return uiObjects.emplace_back(std::make_unique<Object>(name_, tag_)).get();
+    return AddObject(uiObjects, name_, tag_, true);
+}
+
+Object* Scene::AddObject(std::vector<PoolPtr<Object>>& objects_, std::string_view name_, std::string_view tag_, bool isUI_) noexcept
+{
+    Object* const object = objects_.emplace_back(Pool<Object>::Make(name_, tag_)).get();
+    object->sceneIndex   = static_cast<std::uint32_t>(objects_.size() - 1);
+    object->scene        = this;
+    object->isUI         = isUI_;
+
+    IndexObject(object);
+
+    for (const PoolPtr<Component>& component : object->components)
+    {
+        RegisterComponent(component.get());
+    }
+
+    return object;
+}
+
+void Scene::RegisterComponent(Component* const component_) noexcept
+{
+    std::vector<Object*>& owners = componentIndex[component_->typeID];
+    component_->typeIndex        = static_cast<std::uint32_t>(owners.size());
+    owners.push_back(component_->owner);
+
+    const ComponentHooks hooks = component_->hooks;
+
+    // UI 오브젝트의 컴포넌트는 그리기만 하며 Start와 갱신 함수들은 호출되지 않습니다.
+    if ((hooks & ComponentRegistry::StartHook) && !component_->owner->isUI)
+    {
+        pendingStartComponents.push_back(component_);
+    }
+    else
+    {
+        // Start를 재정의하지 않았다면 곧바로 갱신을 시작할 수 있습니다.
+        component_->SetStarted();
+    }
+
+    RegisterHooks(component_);
+
+    if (!component_->owner->isUI && component_->typeID == ComponentRegistry::GetTypeID<Camera>())
+    {
+        cameras.push_back(static_cast<Camera*>(component_));
+    }
+}
+
+void Scene::RegisterHooks(Component* const component_) noexcept
+{
+    const ComponentHooks hooks = component_->hooks;
+    const Object* const  owner = component_->owner;
+
+    // 정적 오브젝트와 UI 오브젝트의 컴포넌트는 매 프레임 갱신하지 않습니다.
+    if (!owner->isStatic && !owner->isUI)
+    {
+        if (hooks & ComponentRegistry::UpdateHook)
+        {
+            (hooks & ComponentRegistry::ParallelHook ? parallelUpdateComponents : updateComponents).push_back(component_);
+        }
+
+        if (hooks & ComponentRegistry::FixedUpdateHook)
+        {
+            fixedUpdateComponents.push_back(component_);
+        }
+
+        if (hooks & ComponentRegistry::LateUpdateHook)
+        {
+            lateUpdateComponents.push_back(component_);
+        }
+    }
+
+    if (hooks & ComponentRegistry::RenderHook)
+    {
+        if (owner->isUI)
+        {
+            uiRenderComponents.push_back(component_);
+        }
+        else if (owner->isStatic)
+        {
+            staticRenderComponents.push_back(component_);
+            isStaticBucketDirty = true;
+        }
+        else
+        {
+            renderComponents.push_back(component_);
+            isRenderBucketDirty = true;
+        }
+    }
+}
+
+void Scene::UnregisterHooks(Component* const component_) noexcept
+{
+    const ComponentHooks hooks = component_->hooks;
+
+    if (hooks & ComponentRegistry::UpdateHook)
+    {
+        std::erase(hooks & ComponentRegistry::ParallelHook ? parallelUpdateComponents : updateComponents, component_);
+    }
+
+    if (hooks & ComponentRegistry::FixedUpdateHook)
+    {
+        std::erase(fixedUpdateComponents, component_);
+    }
+
+    if (hooks & ComponentRegistry::LateUpdateHook)
+    {
+        std::erase(lateUpdateComponents, component_);
+    }
+
+    if (hooks & ComponentRegistry::RenderHook)
+    {
+        if (std::erase(renderComponents, component_) != 0)
+        {
+            isRenderBucketDirty = true;
+        }
+
+        std::erase(uiRenderComponents, component_);
+        if (std::erase(staticRenderComponents, component_) != 0)
+        {
+            isStaticBucketDirty = true;
+        }
+    }
+}
+
+void Scene::ChangeStatic(Object* const object_) noexcept
+{
+    if (object_->isStatic)
+    {
+        ++staticObjectCount;
+    }
+    else
+    {
+        --staticObjectCount;
+    }
+
+    for (const PoolPtr<Component>& component : object_->components)
+    {
+        if (component->isDestroyed)
+        {
+            continue;
+        }
+
+        UnregisterHooks(component.get());
+        RegisterHooks(component.get());
+    }
+}
+
+void Scene::RebuildRenderBuckets(const std::vector<Component*>& components_, std::vector<RenderBucket>& buckets_) noexcept
+{
+    buckets_.clear();
+
+    std::vector<Component*> sorted = components_;
+
+    // 레이어, 셰이더, 텍스처, 메쉬 순으로 정렬하여 같은 레이어와 상태를 사용하는 컴포넌트들이 이웃하도록 합니다.
+    const auto getKey = [](const Component* const component_) {
+        const std::uint8_t layer = component_->GetOwner()->GetLayer();
+
+        if (component_->typeID == ComponentRegistry::GetTypeID<MeshRenderer>())
+        {
+            const MeshRenderer* const renderer = static_cast<const MeshRenderer*>(component_);
+
+            Shader* const  shader  = renderer->GetShader();
+            Texture* const texture = renderer->GetTexture();
+            Mesh* const    mesh    = renderer->GetMesh();
+
+            // 그릴 수 없는 렌더러는 개별 Render에서 오류를 보고하도록, 반투명한 렌더러는 깊이 순으로 정렬되도록 인스턴싱에서 제외합니다.
+            const bool    isInstanced     = shader && texture && mesh && !renderer->IsTransparent();
+            Shader* const instancedShader = isInstanced ? renderer->GetInstancedShader() : nullptr;
+
+            return std::make_tuple(layer, shader, texture, mesh, instancedShader);
+        }
+
+        return std::tuple<std::uint8_t, Shader*, Texture*, Mesh*, Shader*>(layer, nullptr, nullptr, nullptr, nullptr);
+    };
+
+    std::stable_sort(sorted.begin(), sorted.end(), [&getKey](const Component* const lhs, const Component* const rhs) {
+        return getKey(lhs) < getKey(rhs);
+    });
+
+    for (Component* const component : sorted)
+    {
+        const auto [layer, shader, texture, mesh, instancedShader] = getKey(component);
+
+        if (buckets_.empty() || buckets_.back().layer != layer || buckets_.back().shader != shader ||
+            buckets_.back().texture != texture || buckets_.back().mesh != mesh ||
+            buckets_.back().instancedShader != instancedShader)
+        {
+            buckets_.push_back({ layer, shader, texture, mesh, instancedShader, {}, 0, 0, {} });
+        }
+
+        buckets_.back().components.push_back(component);
+    }
+}
+
+void Scene::InvalidateRenderBuckets() noexcept
+{
+    isRenderBucketDirty = true;
+    isStaticBucketDirty = true;
+}
+
+void Scene::UploadInstances(const Frustum& frustum_, const ScreenProjection& screenProjection_, const std::uint32_t cullingMask_) noexcept
+{
+    instances.clear();
+
+    for (std::vector<RenderBucket>* const buckets : { &renderBuckets, &staticRenderBuckets })
+    {
+        for (RenderBucket& bucket : *buckets)
+        {
+            if (!bucket.instancedShader)
+            {
+                continue;
+            }
+
+            bucket.firstInstance = static_cast<std::uint32_t>(instances.size());
+            bucket.instanceCount = 0;
+            bucket.lodInstanceCounts.fill(0);
+
+            if (!IsLayerIncluded(bucket, cullingMask_))
+            {
+                cullingStatistics.maskedCount += bucket.components.size();
+                continue;
+            }
+
+            for (std::vector<Mesh::InstanceData>& lodInstance : lodInstances)
+            {
+                lodInstance.clear();
+            }
+
+            // 인스턴싱 버킷은 MeshRenderer로만 이루어집니다.
+            for (Component* const component : bucket.components)
+            {
+                if (CanInvoke(component) && IsVisible(bucket, component, frustum_))
+                {
+                    MeshRenderer* const renderer = static_cast<MeshRenderer*>(component);
+
+                    const std::uint32_t lod   = renderer->SelectLod(screenProjection_);
+                    const float         layer = static_cast<float>(renderer->GetTextureLayer());
+                    lodInstances[lod].push_back({ component->GetTransform()->GetWorldMatrix(), glm::fvec4(layer, 0.0f, 0.0f, 0.0f) });
+                }
+            }
+
+            for (std::size_t lod = 0; lod < lodInstances.size(); ++lod)
+            {
+                instances.insert(instances.end(), lodInstances[lod].begin(), lodInstances[lod].end());
+                bucket.lodInstanceCounts[lod] = static_cast<std::uint32_t>(lodInstances[lod].size());
+            }
+            bucket.instanceCount = static_cast<std::uint32_t>(instances.size()) - bucket.firstInstance;
+        }
+    }
+
+    if (instances.empty())
+    {
+        return;
+    }
+
+    if (instanceBuffer == 0)
+    {
+        glGenBuffers(1, &instanceBuffer);
+    }
+
+    // 매 프레임 새 저장 공간을 할당받아 이전 프레임의 드로우 콜이 끝나기를 기다리지 않도록 합니다.
+    GraphicsState::BindBuffer(GL_ARRAY_BUFFER, instanceBuffer);
+    glBufferData(GL_ARRAY_BUFFER,
+                 static_cast<GLsizeiptr>(instances.size() * sizeof(Mesh::InstanceData)),
+                 instances.data(),
+                 GL_STREAM_DRAW);
+}
+
+void Scene::SubmitBuckets(const std::vector<RenderBucket>& buckets_,
+                          const Frustum&                   frustum_,
+                          const ScreenProjection&          screenProjection_,
+                          const std::uint32_t              cullingMask_) noexcept
+{
+    for (const RenderBucket& bucket : buckets_)
+    {
+        // 인스턴싱 버킷은 UploadInstances에서 이미 집계했습니다.
+        if (!IsLayerIncluded(bucket, cullingMask_))
+        {
+            if (!bucket.instancedShader)
+            {
+                cullingStatistics.maskedCount += bucket.components.size();
+            }
+            continue;
+        }
+
+        if (bucket.instancedShader)
+        {
+            // LOD마다 하나의 드로우 콜을 제출합니다. 인스턴스가 없는 LOD는 렌더 큐가 건너뜁니다.
+            std::uint32_t firstInstance = bucket.firstInstance;
+            for (std::uint32_t lod = 0; lod < Mesh::MaxLodCount; ++lod)
+            {
+                RenderQueue::SubmitInstanced(RenderQueue::Layer::World,
+                                             bucket.instancedShader,
+                                             bucket.texture,
+                                             bucket.mesh,
+                                             instanceBuffer,
+                                             firstInstance,
+                                             bucket.lodInstanceCounts[lod],
+                                             lod);
+                firstInstance += bucket.lodInstanceCounts[lod];
+            }
+            continue;
+        }
+
+        // 인스턴싱하지 않는 컴포넌트들은 Render에서 각자 패킷을 제출합니다. 메쉬 렌더러는 그 전에 이번 카메라로 LOD를 고릅니다.
+        for (Component* const component : bucket.components)
+        {
+            if (CanInvoke(component) && IsVisible(bucket, component, frustum_))
+            {
+                if (component->typeID == ComponentRegistry::GetTypeID<MeshRenderer>())
+                {
+                    static_cast<MeshRenderer*>(component)->SelectLod(screenProjection_);
+                }
+
+                component->Render();
+            }
+        }
+    }
+}
+
+bool Scene::IsVisible(const RenderBucket& bucket_, const Component* const component_, const Frustum& frustum_) noexcept
+{
+    if (bucket_.mesh && !frustum_.Intersects(bucket_.mesh->GetBounds(), component_->GetTransform()->GetWorldMatrix()))
+    {
+        ++cullingStatistics.culledCount;
+        return false;
+    }
+
+    ++cullingStatistics.drawnCount;
+    return true;
+}
+
+Object* Scene::FindByTag(std::string_view tag_) const noexcept
+{
+    const std::vector<Object*>& result = FindAllByTag(tag_);
+    return result.empty() ? nullptr : result.front();
+}
+
+const std::vector<Object*>& Scene::FindAllByTag(std::string_view tag_) const noexcept
+{
+    const NameID tag = NameRegistry::Find(tag_);
+    if (tag == NameRegistry::InvalidID)
+    {
+        return emptyObjects;
+    }
+
+    const auto iter = tagIndex.find(tag);
+    return iter != tagIndex.end() ? iter->second : emptyObjects;
+}
+
+void Scene::IndexObject(Object* const object_) noexcept
+{
+    std::vector<Object*>& tagged = tagIndex[object_->tag];
+    object_->tagIndex            = static_cast<std::uint32_t>(tagged.size());
+    tagged.push_back(object_);
+}
+
+void Scene::UnindexObject(Object* const object_) noexcept
+{
+    std::vector<Object*>& tagged = tagIndex[object_->tag];
+
+    // 마지막 오브젝트를 빈 자리로 옮겨 O(1)에 제거합니다.
+    Object* const last        = tagged.back();
+    tagged[object_->tagIndex] = last;
+    last->tagIndex            = object_->tagIndex;
+    tagged.pop_back();
+}
+
+void Scene::UnindexComponent(Component* const component_) noexcept
+{
+    const ComponentTypeID typeID = component_->typeID;
+    std::vector<Object*>& owners = componentIndex[typeID];
+
+    Object* const last                      = owners.back();
+    owners[component_->typeIndex]           = last;
+    last->componentSlots[typeID]->typeIndex = component_->typeIndex;
+    owners.pop_back();
+}
+
+void Scene::QueueDestroy(Object* const object_) noexcept
+{
+    UnindexObject(object_);
+
+    if (object_->isStatic)
+    {
+        --staticObjectCount;
+    }
+
+    for (const PoolPtr<Component>& component : object_->components)
+    {
+        if (!component->isDestroyed)
+        {
+            UnindexComponent(component.get());
+        }
+    }
+
+    destroyedObjects.push_back(object_);
+}
+
+void Scene::QueueDestroy(Component* const component_) noexcept
+{
+    // 오브젝트와 함께 파괴되는 중이라면 이미 색인에서 제거되었습니다.
+    if (!component_->owner->isDestroyed)
+    {
+        UnindexComponent(component_);
+    }
+
+    destroyedComponents.push_back(component_);
+}
+
+void Scene::StartPendingComponents() noexcept
+{
+    if (pendingStartComponents.empty())
+    {
+        return;
+    }
+
+    std::vector<Component*> startingComponents;
+    startingComponents.swap(pendingStartComponents);
+
+    for (Component* const component : startingComponents)
+    {
+        if (component->isDestroyed)
+        {
+            continue;
+        }
+
+        // 비활성화된 컴포넌트는 활성화된 뒤 첫 프레임에 Start됩니다.
+        if (!CanInvoke(component))
+        {
+            pendingStartComponents.push_back(component);
+            continue;
+        }
+
+        component->Start();
+        component->SetStarted();
+    }
+}
+
+void Scene::UpdateParallelComponents() noexcept
+{
+    parallelBatch.clear();
+
+    for (Component* const component : parallelUpdateComponents)
+    {
+        if (!component->isStarted || !CanInvoke(component))
+        {
+            continue;
+        }
+
+        Transform* root = component->GetTransform();
+        while (root->GetParent())
+        {
+            root = root->GetParent();
+        }
+
+        parallelBatch.emplace_back(root, component);
+    }
+
+    if (parallelBatch.empty())
+    {
+        return;
+    }
+
+    // 같은 계층 구조에 속한 컴포넌트들은 같은 작업에서 등록 순서대로 갱신되도록 루트 트랜스폼으로 묶습니다.
+    std::stable_sort(parallelBatch.begin(), parallelBatch.end(), [](const auto& lhs, const auto& rhs) {
+        return std::less<Transform*>()(lhs.first, rhs.first);
+    });
+
+    parallelGroups.clear();
+    for (std::size_t index = 0; index < parallelBatch.size(); ++index)
+    {
+        if (index == 0 || parallelBatch[index].first != parallelBatch[index - 1].first)
+        {
+            parallelGroups.push_back(index);
+        }
+    }
+    parallelGroups.push_back(parallelBatch.size());
+
+    const std::size_t groupCount = parallelGroups.size() - 1;
+    const std::size_t grainSize  = std::max<std::size_t>(groupCount / (JobSystem::GetThreadCount() * 4), 1);
+
+    JobSystem::ParallelFor(groupCount, grainSize, [this](const std::size_t begin_, const std::size_t end_) {
+        for (std::size_t group = begin_; group < end_; ++group)
+        {
+            for (std::size_t index = parallelGroups[group]; index < parallelGroups[group + 1]; ++index)
+            {
+                parallelBatch[index].second->Update();
+            }
+        }
+    });
+}
+
+std::size_t Scene::ProcessDestroyQueue() noexcept
+{
+    if (destroyedObjects.empty() && destroyedComponents.empty())
+    {
+        return 0;
+    }
+
+    // 1. 파괴되는 오브젝트의 컴포넌트들도 파괴 대상으로 표시한 뒤 OnDestroy를 호출합니다.
+    for (Component* const component : destroyedComponents)
+    {
+        if (!component->owner->isDestroyed)
+        {
+            component->OnDestroy();
+        }
+    }
+
+    for (Object* const object : destroyedObjects)
+    {
+        for (const PoolPtr<Component>& component : object->components)
+        {
+            component->isDestroyed = true;
+            component->OnDestroy();
+        }
+    }
+
+    // 2. 호출 목록은 실행 순서를 유지해야 하므로 목록마다 한 번씩만 압축합니다.
+    const auto isDestroyed = [](const Component* const component) { return component->isDestroyed; };
+    std::erase_if(pendingStartComponents, isDestroyed);
+    std::erase_if(updateComponents, isDestroyed);
+    std::erase_if(parallelUpdateComponents, isDestroyed);
+    std::erase_if(fixedUpdateComponents, isDestroyed);
+    std::erase_if(lateUpdateComponents, isDestroyed);
+    if (std::erase_if(renderComponents, isDestroyed) != 0)
+    {
+        isRenderBucketDirty = true;
+    }
+    std::erase_if(uiRenderComponents, isDestroyed);
+    if (std::erase_if(staticRenderComponents, isDestroyed) != 0)
+    {
+        isStaticBucketDirty = true;
+    }
+    std::erase_if(cameras, isDestroyed);
+
+    // 3. 컴포넌트와 오브젝트를 해제하고, 빈 자리는 마지막 원소로 채웁니다.
+    std::size_t reclaimedObjects    = 0;
+    std::size_t reclaimedComponents = 0;
+
+    for (Component* const component : destroyedComponents)
+    {
+        Object* const owner = component->owner;
+        if (owner->isDestroyed)
+        {
+            continue;
+        }
+
+        owner->ReleaseComponent(component);
+        ++reclaimedComponents;
+    }
+
+    for (Object* const object : destroyedObjects)
+    {
+        std::vector<PoolPtr<Object>>& container = object->isUI ? uiObjects : objects;
+        const std::uint32_t           index     = object->sceneIndex;
+
+        reclaimedComponents += object->components.size();
+        ++reclaimedObjects;
+
+        if (index + 1 != container.size())
+        {
+            std::swap(container[index], container.back());
+            container[index]->sceneIndex = index;
+        }
+        container.pop_back();
+    }
+
+    destroyedObjects.clear();
+    destroyedComponents.clear();
+
+    reclaimedObjectCount += reclaimedObjects;
+    reclaimedComponentCount += reclaimedComponents;
+
+    return reclaimedObjects + reclaimedComponents;
 }
 
 void Scene::Remove(Object entity) noexcept
@@ -143,7 +848,8 @@ void SceneManager::Update() noexcept
 
     if (nextScene)
     {
-        texAlpha += TimeManager::GetUnscaledDeltaTime() * 2.0f;
+        // 처음 로드하는 씬은 가릴 이전 씬이 없으므로 페이드를 기다리지 않고 이번 프레임에 바로 들어갑니다.
+        texAlpha = currentScene ? texAlpha + TimeManager::GetUnscaledDeltaTime() * 2.0f : 1.0f;
         if (texAlpha >= 1.0f)
         {
             if (currentScene)
@@ -169,17 +875,16 @@ void SceneManager::Update() noexcept
 
 void SceneManager::Render() noexcept
 {
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    GraphicsState::SetBlending(true);
+    GraphicsState::SetBlendFunction(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     loadingShader->Use();
+    loadingShader->SetUniformVector3("positionScale", loadingMesh->GetPositionScale());
+    loadingShader->SetUniformVector3("positionOffset", loadingMesh->GetPositionOffset());
 
     float width  = (float)Application::GetWindowWidth();
     float height = (float)Application::GetWindowHeight();
 
-    glm::mat4 projection = glm::ortho(0.0f, width, height, 0.0f, -1.0f, 1.0f);
-    loadingShader->SetUniformMatrix4x4("projection", projection);
-
     {
         glm::mat4 model = glm::mat4(1.0f);
         model           = glm::translate(model, glm::vec3(width / 2.0f, height / 2.0f, 0.0f));
@@ -187,8 +892,7 @@ void SceneManager::Render() noexcept
 
         loadingShader->SetUniformMatrix4x4("model", model);
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, backgroundTex->GetTextureID());
+        GraphicsState::BindTexture(0, GL_TEXTURE_2D, backgroundTex->GetTextureID());
         loadingShader->SetUniformInt("outTexture", 0);
 
         loadingShader->SetUniformVector4("color", glm::vec4(1.0f, 1.0f, 1.0f, texAlpha));
@@ -203,8 +907,7 @@ void SceneManager::Render() noexcept
 
         loadingShader->SetUniformMatrix4x4("model", model);
 
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_2D, loadingTex->GetTextureID());
+        GraphicsState::BindTexture(0, GL_TEXTURE_2D, loadingTex->GetTextureID());
         loadingShader->SetUniformInt("outTexture", 0);
 
         loadingShader->SetUniformVector4("color", glm::vec4(1.0f, 1.0f, 1.0f, texAlpha));
@@ -243,6 +946,7 @@ void SceneManager::UnloadScene() noexcept
         return;
     }
 
+    currentScene->Exit();
     currentScene = nullptr;
 }
 
@@ -2,10 +2,34 @@
 
 #include "Common.h"
 #include "Objects.h"
+#include "Resources.h"
 
-class Shader;
-class Texture;
-class Mesh;
+class Camera;
+struct Frustum;
+struct ScreenProjection;
+
+/**
+ * @struct CullingStatistics
+ *
+ * @brief 한 프레임 동안의 컬링 통계를 정의합니다. 카메라가 여럿이라면 카메라별 결과가 누적됩니다.
+ */
+struct CullingStatistics
+{
+    /**
+     * @brief 절두체 안에 있어 그려진 렌더러의 개수.
+     */
+    std::size_t drawnCount = 0;
+
+    /**
+     * @brief 절두체 밖에 있어 그리지 않은 렌더러의 개수.
+     */
+    std::size_t culledCount = 0;
+
+    /**
+     * @brief 카메라의 컬링 마스크에 레이어가 포함되지 않아 순회하지 않은 렌더러의 개수.
+     */
+    std::size_t maskedCount = 0;
+};
 
 /**
  * @class Scene
@@ -14,6 +38,10 @@ class Mesh;
  */
 class Scene
 {
+    friend class Component;
+    friend class MeshRenderer;
+    friend class Object;
+
 public:
     /**
      * @brief 소멸자.
@@ -50,6 +78,119 @@ class Scene
      */
     void Exit() noexcept;
 
+    /**
+     * @brief 이번 프레임에 파괴된 오브젝트와 컴포넌트들을 한꺼번에 해제합니다.
+     *
+     * @return std::size_t 해제된 오브젝트와 컴포넌트의 개수
+     */
+    std::size_t ProcessDestroyQueue() noexcept;
+
+    /**
+     * @brief 지금까지 해제된 오브젝트의 개수를 반환합니다.
+     *
+     * @return std::size_t 지금까지 해제된 오브젝트의 개수
+     */
+    [[nodiscard]]
+    inline std::size_t GetReclaimedObjectCount() const noexcept
+    {
+        return reclaimedObjectCount;
+    }
+
+    /**
+     * @brief 지금까지 해제된 컴포넌트의 개수를 반환합니다.
+     *
+     * @return std::size_t 지금까지 해제된 컴포넌트의 개수
+     */
+    [[nodiscard]]
+    inline std::size_t GetReclaimedComponentCount() const noexcept
+    {
+        return reclaimedComponentCount;
+    }
+
+    /**
+     * @brief 이번 프레임에 병렬 갱신 단계(UpdateParallelComponents)에 걸린 시간을 반환합니다.
+     *
+     * @return double 밀리초 단위의 시간
+     */
+    [[nodiscard]]
+    inline double GetParallelUpdateTime() const noexcept
+    {
+        return parallelUpdateTime;
+    }
+
+    /**
+     * @brief 이번 프레임의 절두체 컬링 통계를 반환합니다.
+     *
+     * @return const CullingStatistics& 절두체 컬링 통계
+     */
+    [[nodiscard]]
+    inline const CullingStatistics& GetCullingStatistics() const noexcept
+    {
+        return cullingStatistics;
+    }
+
+    /**
+     * @brief 해당 씬의 정적 오브젝트 개수를 반환합니다.
+     *
+     * @return std::size_t 정적 오브젝트의 개수
+     */
+    [[nodiscard]]
+    inline std::size_t GetStaticObjectCount() const noexcept
+    {
+        return staticObjectCount;
+    }
+
+    /**
+     * @brief 해당 씬의 동적 오브젝트 개수를 반환합니다.
+     *
+     * @return std::size_t 동적 오브젝트의 개수
+     */
+    [[nodiscard]]
+    inline std::size_t GetDynamicObjectCount() const noexcept
+    {
+        return objects.size() + uiObjects.size() - destroyedObjects.size() - staticObjectCount;
+    }
+
+    /**
+     * @brief 지정한 태그를 가진 오브젝트 하나를 찾습니다.
+     *
+     * @param tag_ 찾을 태그
+     *
+     * @return Object* 지정한 태그를 가진 오브젝트. 없다면 nullptr
+     */
+    [[nodiscard]]
+    Object* FindByTag(std::string_view tag_) const noexcept;
+
+    /**
+     * @brief 지정한 태그를 가진 모든 오브젝트를 찾습니다.
+     *
+     * @param tag_ 찾을 태그
+     *
+     * @return const std::vector<Object*>& 지정한 태그를 가진 오브젝트들
+     */
+    [[nodiscard]]
+    const std::vector<Object*>& FindAllByTag(std::string_view tag_) const noexcept;
+
+    /**
+     * @brief 지정한 타입의 컴포넌트를 가진 모든 오브젝트를 찾습니다.
+     *
+     * @tparam TComponent 지정할 타입
+     *
+     * @return const std::vector<Object*>& 지정한 타입의 컴포넌트를 가진 오브젝트들
+     */
+    template <FromComponent TComponent>
+    [[nodiscard]]
+    const std::vector<Object*>& FindAllWithComponent() const noexcept
+    {
+        const ComponentTypeID typeID = ComponentRegistry::GetTypeID<TComponent>();
+        if (typeID >= MaxComponentTypes)
+        {
+            return emptyObjects;
+        }
+
+        return componentIndex[typeID];
+    }
+
 protected:
     Object* AddGameObject(std::string_view name_, std::string_view tag_) noexcept;
     Object* AddUIObject(std::string_view name_, std::string_view tag_) noexcept;
@@ -104,8 +245,345 @@ class Scene
     }
 
 private:
-    std::vector<std::unique_ptr<Object>> objects;
-    std::vector<std::unique_ptr<Object>> uiObjects;
+    /**
+     * @struct RenderBucket
+     *
+     * @brief 같은 레이어에 속하고 같은 셰이더, 텍스처, 메쉬를 사용하는 렌더링 컴포넌트들의 묶음을 정의합니다.
+     *        인스턴싱용 셰이더가 있다면 묶음 전체를 한 번의 드로우 콜로 그립니다.
+     */
+    struct RenderBucket
+    {
+        std::uint8_t            layer;
+        Shader*                 shader;
+        Texture*                texture;
+        Mesh*                   mesh;
+        Shader*                 instancedShader;
+        std::vector<Component*> components;
+
+        /**
+         * @brief 이번 프레임의 인스턴스 버퍼에서 해당 묶음이 시작하는 위치.
+         */
+        std::uint32_t firstInstance;
+
+        /**
+         * @brief 이번 프레임에 그릴 인스턴스의 개수.
+         */
+        std::uint32_t instanceCount;
+
+        /**
+         * @brief 이번 프레임에 LOD별로 그릴 인스턴스의 개수. 인스턴스는 firstInstance부터 LOD 순서로 놓입니다.
+         */
+        std::array<std::uint32_t, Mesh::MaxLodCount> lodInstanceCounts;
+    };
+
+    /**
+     * @brief 오브젝트를 생성하여 지정한 목록에 추가합니다.
+     *
+     * @param objects_ 오브젝트를 추가할 목록
+     * @param name_    생성할 오브젝트의 이름
+     * @param tag_     생성할 오브젝트의 태그
+     * @param isUI_    UI 오브젝트인지 여부
+     *
+     * @return Object* 생성된 오브젝트
+     */
+    Object* AddObject(std::vector<PoolPtr<Object>>& objects_, std::string_view name_, std::string_view tag_, bool isUI_) noexcept;
+
+    /**
+     * @brief 컴포넌트가 재정의한 생명주기 함수에 따라 호출 목록에 등록합니다.
+     *
+     * @param component_ 등록할 컴포넌트
+     */
+    void RegisterComponent(Component* const component_) noexcept;
+
+    /**
+     * @brief 컴포넌트를 오너의 정적 여부에 맞는 Update/FixedUpdate/LateUpdate/Render 호출 목록에 등록합니다.
+     *
+     * @param component_ 등록할 컴포넌트
+     */
+    void RegisterHooks(Component* const component_) noexcept;
+
+    /**
+     * @brief 컴포넌트를 Update/FixedUpdate/LateUpdate/Render 호출 목록에서 제거합니다.
+     *
+     * @param component_ 제거할 컴포넌트
+     */
+    void UnregisterHooks(Component* const component_) noexcept;
+
+    /**
+     * @brief 오브젝트의 정적 여부가 바뀌었을 때 컴포넌트들을 알맞은 호출 목록으로 옮깁니다.
+     *
+     * @param object_ 정적 여부가 바뀐 오브젝트
+     */
+    void ChangeStatic(Object* const object_) noexcept;
+
+    /**
+     * @brief 렌더링 컴포넌트들을 레이어, 셰이더, 텍스처, 메쉬별 버킷으로 다시 묶습니다.
+     *
+     * @param components_ 묶을 렌더링 컴포넌트들
+     * @param buckets_    묶은 결과를 저장할 버킷들
+     */
+    void RebuildRenderBuckets(const std::vector<Component*>& components_, std::vector<RenderBucket>& buckets_) noexcept;
+
+    /**
+     * @brief 렌더링 컴포넌트의 속성이 바뀌었으므로 모든 렌더링 버킷을 다시 묶도록 표시합니다.
+     */
+    void InvalidateRenderBuckets() noexcept;
+
+    /**
+     * @brief 인스턴싱으로 그릴 버킷들 중 카메라가 그리는 레이어에 속하고 절두체 안에 있는 인스턴스 데이터만 모아 인스턴스 버퍼에 한 번에 올립니다.
+     *
+     * @details 인스턴스마다 LOD를 고르고, 버킷 안에서 같은 LOD끼리 이어지도록 놓아 LOD마다 한 번의 드로우 콜로 그립니다.
+     *
+     * @param frustum_          렌더링 중인 카메라의 절두체
+     * @param screenProjection_ 렌더링 중인 카메라의 화면 투영 정보
+     * @param cullingMask_      렌더링 중인 카메라의 컬링 마스크
+     */
+    void UploadInstances(const Frustum& frustum_, const ScreenProjection& screenProjection_, std::uint32_t cullingMask_) noexcept;
+
+    /**
+     * @brief 렌더링 버킷들 중 카메라가 그리는 레이어에 속하고 절두체 안에 있는 드로우 패킷을 렌더 큐에 제출합니다.
+     *
+     * @param buckets_          제출할 버킷들
+     * @param frustum_          렌더링 중인 카메라의 절두체
+     * @param screenProjection_ 렌더링 중인 카메라의 화면 투영 정보. 인스턴싱하지 않는 메쉬 렌더러의 LOD를 고르는 데 사용합니다.
+     * @param cullingMask_      렌더링 중인 카메라의 컬링 마스크
+     */
+    void SubmitBuckets(const std::vector<RenderBucket>& buckets_,
+                       const Frustum&                   frustum_,
+                       const ScreenProjection&          screenProjection_,
+                       std::uint32_t                    cullingMask_) noexcept;
+
+    /**
+     * @brief 버킷의 레이어가 컬링 마스크에 포함되는지 검사합니다.
+     *
+     * @param bucket_      검사할 버킷
+     * @param cullingMask_ 렌더링 중인 카메라의 컬링 마스크
+     *
+     * @return bool 포함 여부
+     */
+    [[nodiscard]]
+    static inline bool IsLayerIncluded(const RenderBucket& bucket_, const std::uint32_t cullingMask_) noexcept
+    {
+        return (cullingMask_ >> bucket_.layer) & 1u;
+    }
+
+    /**
+     * @brief 버킷의 컴포넌트가 절두체 안에 있는지 검사하고 컬링 통계를 갱신합니다.
+     *
+     * @param bucket_    컴포넌트가 속한 버킷. 메쉬가 없다면 경계를 알 수 없으므로 항상 그립니다.
+     * @param component_ 검사할 컴포넌트
+     * @param frustum_   렌더링 중인 카메라의 절두체
+     *
+     * @return bool 그려야 하는지 여부
+     */
+    bool IsVisible(const RenderBucket& bucket_, const Component* const component_, const Frustum& frustum_) noexcept;
+
+    /**
+     * @brief 오브젝트를 태그 색인에 추가합니다.
+     *
+     * @param object_ 추가할 오브젝트
+     */
+    void IndexObject(Object* const object_) noexcept;
+
+    /**
+     * @brief 오브젝트를 태그 색인에서 제거합니다.
+     *
+     * @param object_ 제거할 오브젝트
+     */
+    void UnindexObject(Object* const object_) noexcept;
+
+    /**
+     * @brief 컴포넌트의 오너를 컴포넌트 색인에서 제거합니다.
+     *
+     * @param component_ 제거할 컴포넌트
+     */
+    void UnindexComponent(Component* const component_) noexcept;
+
+    /**
+     * @brief 오브젝트를 파괴 대기열에 추가하고 색인에서 제거합니다.
+     *
+     * @param object_ 파괴할 오브젝트
+     */
+    void QueueDestroy(Object* const object_) noexcept;
+
+    /**
+     * @brief 컴포넌트를 파괴 대기열에 추가하고 색인에서 제거합니다.
+     *
+     * @param component_ 파괴할 컴포넌트
+     */
+    void QueueDestroy(Component* const component_) noexcept;
+
+    /**
+     * @brief 아직 Start되지 않은 컴포넌트들의 Start를 호출합니다.
+     */
+    void StartPendingComponents() noexcept;
+
+    /**
+     * @brief 병렬로 갱신할 수 있는 컴포넌트들을 계층 구조별로 묶어 작업 스레드들에서 갱신합니다.
+     *        다른 컴포넌트들의 Update보다 먼저 호출되므로, 이들은 같은 프레임에 병렬 갱신된 결과를 읽습니다.
+     */
+    void UpdateParallelComponents() noexcept;
+
+    /**
+     * @brief 지정한 컴포넌트의 생명주기 함수를 호출할 수 있는지 여부를 반환합니다.
+     *
+     * @param component_ 검사할 컴포넌트
+     *
+     * @return bool 생명주기 함수를 호출할 수 있는지 여부
+     */
+    [[nodiscard]]
+    static inline bool CanInvoke(const Component* const component_) noexcept
+    {
+        return component_->isEnabled && !component_->isDestroyed && component_->owner->IsEnabled();
+    }
+
+    std::vector<PoolPtr<Object>> objects;
+    std::vector<PoolPtr<Object>> uiObjects;
+
+    /**
+     * @brief Start 호출을 기다리는 컴포넌트들.
+     */
+    std::vector<Component*> pendingStartComponents;
+
+    /**
+     * @brief Update를 재정의한 컴포넌트들 중 메인 스레드에서 갱신해야 하는 컴포넌트들.
+     */
+    std::vector<Component*> updateComponents;
+
+    /**
+     * @brief Update를 재정의한 컴포넌트들 중 작업 스레드에서 병렬로 갱신할 수 있는 컴포넌트들.
+     */
+    std::vector<Component*> parallelUpdateComponents;
+
+    /**
+     * @brief 이번 프레임에 병렬로 갱신할 컴포넌트들과 그 계층 구조의 루트 트랜스폼.
+     */
+    std::vector<std::pair<Transform*, Component*>> parallelBatch;
+
+    /**
+     * @brief parallelBatch에서 같은 계층 구조에 속한 컴포넌트 묶음들의 시작 위치.
+     */
+    std::vector<std::size_t> parallelGroups;
+
+    /**
+     * @brief 이번 프레임에 병렬 갱신 단계에 걸린 시간. (밀리초)
+     */
+    double parallelUpdateTime = 0.0;
+
+    /**
+     * @brief FixedUpdate를 재정의한 컴포넌트들.
+     */
+    std::vector<Component*> fixedUpdateComponents;
+
+    /**
+     * @brief LateUpdate를 재정의한 컴포넌트들.
+     */
+    std::vector<Component*> lateUpdateComponents;
+
+    /**
+     * @brief Render를 재정의한 게임 오브젝트의 컴포넌트들.
+     */
+    std::vector<Component*> renderComponents;
+
+    /**
+     * @brief renderComponents를 셰이더, 텍스처, 메쉬별로 묶어 둔 렌더링 버킷들.
+     */
+    std::vector<RenderBucket> renderBuckets;
+
+    /**
+     * @brief 동적 렌더링 버킷들을 다시 묶어야 하는지 여부.
+     */
+    bool isRenderBucketDirty = false;
+
+    /**
+     * @brief Render를 재정의한 정적 게임 오브젝트의 컴포넌트들.
+     */
+    std::vector<Component*> staticRenderComponents;
+
+    /**
+     * @brief staticRenderComponents를 셰이더, 텍스처, 메쉬별로 묶어 둔 렌더링 버킷들.
+     */
+    std::vector<RenderBucket> staticRenderBuckets;
+
+    /**
+     * @brief 정적 렌더링 버킷들을 다시 묶어야 하는지 여부.
+     */
+    bool isStaticBucketDirty = false;
+
+    /**
+     * @brief 이번 프레임의 절두체 컬링 통계.
+     */
+    CullingStatistics cullingStatistics;
+
+    /**
+     * @brief 이번 프레임에 인스턴싱으로 그릴 인스턴스별 데이터들.
+     */
+    std::vector<Mesh::InstanceData> instances;
+
+    /**
+     * @brief UploadInstances에서 버킷 하나의 인스턴스를 LOD별로 나누어 모으는 임시 목록들.
+     */
+    std::array<std::vector<Mesh::InstanceData>, Mesh::MaxLodCount> lodInstances;
+
+    /**
+     * @brief instances를 올리는 인스턴스 버퍼.
+     */
+    unsigned int instanceBuffer = 0;
+
+    /**
+     * @brief 입장한 뒤 첫 프레임의 드로우 콜 통계를 기록했는지 여부.
+     */
+    bool isDrawStatisticsLogged = false;
+
+    /**
+     * @brief Render를 재정의한 UI 오브젝트의 컴포넌트들.
+     */
+    std::vector<Component*> uiRenderComponents;
+
+    /**
+     * @brief 게임 오브젝트에 추가된 카메라들.
+     */
+    std::vector<Camera*> cameras;
+
+    /**
+     * @brief 태그 ID별 오브젝트 색인.
+     */
+    std::unordered_map<NameID, std::vector<Object*>> tagIndex;
+
+    /**
+     * @brief 컴포넌트 타입 ID별 오브젝트 색인.
+     */
+    std::array<std::vector<Object*>, MaxComponentTypes> componentIndex;
+
+    /**
+     * @brief 결과가 없을 때 반환할 빈 목록.
+     */
+    static inline const std::vector<Object*> emptyObjects;
+
+    /**
+     * @brief 이번 프레임에 파괴된 오브젝트들.
+     */
+    std::vector<Object*> destroyedObjects;
+
+    /**
+     * @brief 이번 프레임에 파괴된 컴포넌트들.
+     */
+    std::vector<Component*> destroyedComponents;
+
+    /**
+     * @brief 파괴되지 않은 정적 오브젝트의 개수.
+     */
+    std::size_t staticObjectCount = 0;
+
+    /**
+     * @brief 지금까지 해제된 오브젝트의 개수.
+     */
+    std::size_t reclaimedObjectCount = 0;
+
+    /**
+     * @brief 지금까지 해제된 컴포넌트의 개수.
+     */
+    std::size_t reclaimedComponentCount = 0;
 };
 
 /**
@@ -140,6 +618,8 @@ class SceneManager final
     /**
      * @brief 씬을 로드합니다.
      *
+     * @details 활성화된 씬이 없다면 다음 Update에서 바로 들어가고, 그렇지 않다면 화면이 페이드 아웃된 뒤에 전환됩니다.
+     *
      * @param name_ 로드할 씬의 이름.
      */
     static void LoadScene(std::string_view name_) noexcept;
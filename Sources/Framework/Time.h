@@ -36,6 +36,17 @@ class TimeManager final
         timeScale = value_;
     }
 
+    /**
+     * @brief 현재 프레임이 시작된 시간을 초 단위로 반환합니다.
+     *
+     * @return float 애플리케이션이 시작된 뒤 경과한 시간(초 단위).
+     */
+    [[nodiscard]]
+    static inline float GetTime() noexcept
+    {
+        return currentTime;
+    }
+
     /**
      * @brief 델타 타임(이전 프레임과 현재 프레임 사이의 시간 간격)을 초 단위로 반환합니다.
      *
@@ -1,6 +1,7 @@
 #include "UI.h"
 
 #include "Application.h"
+#include "Rendering.h"
 #include "Resources.h"
 
 ImageRenderer::ImageRenderer(Object* const owner) noexcept
@@ -8,6 +9,7 @@ ImageRenderer::ImageRenderer(Object* const owner) noexcept
     , shader(nullptr)
     , mesh(nullptr)
     , texture(nullptr)
+    , textureLayer(0)
 {
 }
 
@@ -17,59 +19,33 @@ ImageRenderer::~ImageRenderer() noexcept
 
 void ImageRenderer::Render() noexcept
 {
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    shader->Use();
-
-    float width  = (float)Application::GetWindowWidth();
-    float height = (float)Application::GetWindowHeight();
-
-    glm::mat4 projection = glm::ortho(0.0f, width, height, 0.0f, -1.0f, 1.0f);
-    shader->SetUniformMatrix4x4("projection", projection);
-
-    shader->SetUniformMatrix4x4("model", GetTransform()->GetWorldMatrix());
-
-    glActiveTexture(GL_TEXTURE0);
-    glBindTexture(GL_TEXTURE_2D, texture->GetTextureID());
-    shader->SetUniformInt("outTexture", 0);
-
     shader->SetUniformVector4("color", glm::vec4(1.0f, 1.0f, 1.0f, 1.0));
 
-    mesh->Draw();
+    // UI는 z가 큰 것이 위에 그려지도록 렌더 큐가 뒤에서 앞으로 정렬합니다.
+    RenderQueue::Submit(RenderQueue::Layer::UI, true, shader, texture, mesh, GetTransform()->GetWorldMatrix(), textureLayer);
 }
 
 TextRenderer::TextRenderer(Object* const owner) noexcept
     : Component(owner)
     , shader(nullptr)
     , font(nullptr)
-    , text("")
     , color(1.0f, 1.0f, 1.0f, 1.0f)
+    , text("")
     , VAO(0)
-    , VBO(0)
 {
-    // Texture를 사용하는 게 이상적인데 확장할 시간이 없다.
+    // 글자 정점은 매 프레임 공유 스트리밍 버퍼에 기록하므로 정점 배열만 소유합니다.
     glGenVertexArrays(1, &VAO);
-    glGenBuffers(1, &VBO);
-
-    glBindVertexArray(VAO);
-    glBindBuffer(GL_ARRAY_BUFFER, VBO);
 
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+    GraphicsState::BindVertexArray(VAO);
+    GraphicsState::BindBuffer(GL_ARRAY_BUFFER, StreamBuffer::GetBuffer());
 
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), 0);
-
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
 }
 
 TextRenderer::~TextRenderer() noexcept
 {
-    if (VAO)
-        glDeleteVertexArrays(1, &VAO);
-    if (VBO)
-        glDeleteBuffers(1, &VBO);
+    GraphicsState::DeleteVertexArray(VAO);
 }
 
 void TextRenderer::Render() noexcept
@@ -77,21 +53,13 @@ void TextRenderer::Render() noexcept
     if (!shader || !font)
         return;
 
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-
-    shader->Use();
-
-    float     width      = (float)Application::GetWindowWidth();
-    float     height     = (float)Application::GetWindowHeight();
-    glm::mat4 projection = glm::ortho(0.0f, width, height, 0.0f, -1.0f, 1.0f);
-
-    shader->SetUniformMatrix4x4("projection", projection);
-    shader->SetUniformVector4("textColor", color);
-    glActiveTexture(GL_TEXTURE0);
-
-    glBindVertexArray(VAO);
+    RenderQueue::SubmitCallback(RenderQueue::Layer::UI, true, this, [](Component* const component_) {
+        static_cast<TextRenderer*>(component_)->DrawGlyphs();
+    });
+}
 
+void TextRenderer::DrawGlyphs() noexcept
+{
     glm::vec3 pos = GetTransform()->GetPosition();
     float     x   = pos.x;
     float     y   = pos.y;
@@ -99,6 +67,10 @@ void TextRenderer::Render() noexcept
     float scale = GetTransform()->GetScale().x;
     const auto& characters = font->GetCharacters();
 
+    // 문자열 전체의 정점을 모아 한 번에 기록하고, 글자별로 텍스처만 바꾸어 그립니다.
+    glyphVertices.clear();
+    glyphTextures.clear();
+
     for (std::string::const_iterator c = text.begin(); c != text.end(); c++)
     {
         Font::Character ch = characters.at(*c);
@@ -116,25 +88,48 @@ void TextRenderer::Render() noexcept
         float w = ch.size.x * scale;
         float h = ch.size.y * scale;
 
-        float vertices[6][4] = {{xpos, ypos - h, 0.0f, 0.0f},
-                                {xpos, ypos, 0.0f, 1.0f},
-                                {xpos + w, ypos, 1.0f, 1.0f},
+        glyphVertices.insert(glyphVertices.end(),
+                             {glm::vec4(xpos, ypos - h, 0.0f, 0.0f),
+                              glm::vec4(xpos, ypos, 0.0f, 1.0f),
+                              glm::vec4(xpos + w, ypos, 1.0f, 1.0f),
 
-                                {xpos, ypos - h, 0.0f, 0.0f},
-                                {xpos + w, ypos, 1.0f, 1.0f},
-                                {xpos + w, ypos - h, 1.0f, 0.0f}};
+                              glm::vec4(xpos, ypos - h, 0.0f, 0.0f),
+                              glm::vec4(xpos + w, ypos, 1.0f, 1.0f),
+                              glm::vec4(xpos + w, ypos - h, 1.0f, 0.0f)});
+        glyphTextures.push_back(ch.textureID);
 
-        glBindTexture(GL_TEXTURE_2D, ch.textureID);
-
-        glBindBuffer(GL_ARRAY_BUFFER, VBO);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices);
-        glBindBuffer(GL_ARRAY_BUFFER, 0);
+        x += (ch.advance >> 6) * scale;
+    }
 
-        glDrawArrays(GL_TRIANGLES, 0, 6);
+    if (glyphTextures.empty())
+    {
+        return;
+    }
 
-        x += (ch.advance >> 6) * scale;
+    const std::uint32_t firstVertex = StreamBuffer::WriteVertices(glyphVertices);
+    if (firstVertex == StreamBuffer::InvalidVertex)
+    {
+        return;
     }
 
-    glBindVertexArray(0);
-    glBindTexture(GL_TEXTURE_2D, 0);
-}
\ No newline at end of file
+    shader->Use();
+    shader->SetUniformVector4("textColor", color);
+
+    GraphicsState::BindVertexArray(VAO);
+
+    // 같은 글자가 연속되면 한 번에 그립니다.
+    std::size_t begin = 0;
+    while (begin < glyphTextures.size())
+    {
+        std::size_t end = begin + 1;
+        while (end < glyphTextures.size() && glyphTextures[end] == glyphTextures[begin])
+        {
+            ++end;
+        }
+
+        GraphicsState::BindTexture(0, GL_TEXTURE_2D, glyphTextures[begin]);
+        glDrawArrays(GL_TRIANGLES, static_cast<GLint>(firstVertex + begin * 6), static_cast<GLsizei>((end - begin) * 6));
+
+        begin = end;
+    }
+}
@@ -52,13 +52,35 @@ class ImageRenderer : public Component
         texture = texture_;
     }
 
+    /**
+     * @brief 텍스처가 TextureArray일 때 사용할 레이어를 반환합니다.
+     *
+     * @return std::uint32_t 사용할 레이어
+     */
+    [[nodiscard]]
+    inline std::uint32_t GetTextureLayer() const noexcept
+    {
+        return textureLayer;
+    }
+
+    /**
+     * @brief 텍스처가 TextureArray일 때 사용할 레이어를 설정합니다. 셰이더는 sampler2DArray를 사용해야 합니다.
+     *
+     * @param textureLayer_ 사용할 레이어
+     */
+    inline void SetTextureLayer(const std::uint32_t textureLayer_) noexcept
+    {
+        textureLayer = textureLayer_;
+    }
+
 protected:
     virtual void Render() noexcept override;
 
 private:
-    Shader*  shader;
-    Mesh*    mesh;
-    Texture* texture;
+    Shader*       shader;
+    Mesh*         mesh;
+    Texture*      texture;
+    std::uint32_t textureLayer;
 };
 
 class TextRenderer : public Component
@@ -140,6 +162,11 @@ class TextRenderer : public Component
     virtual void Render() noexcept override;
 
 private:
+    /**
+     * @brief 렌더 큐에서 호출되어 글자들을 그립니다.
+     */
+    void DrawGlyphs() noexcept;
+
     Shader* shader;
     Mesh*   mesh;
     Font*   font;
@@ -147,7 +174,16 @@ class TextRenderer : public Component
     glm::vec4    color;
     std::string text;
     unsigned int VAO;
-    unsigned int VBO;
+
+    /**
+     * @brief 스트리밍 버퍼에 기록하기 전에 모아 두는 글자 정점들. 매 프레임 재사용하여 할당을 피합니다.
+     */
+    std::vector<glm::vec4> glyphVertices;
+
+    /**
+     * @brief 글자별 텍스처 ID.
+     */
+    std::vector<unsigned int> glyphTextures;
 };
 
 class Button : public Component
@@ -0,0 +1,278 @@
+#include "BenchmarkScenes.h"
+
+#include "Framework/Debug.h"
+#include "Framework/Jobs.h"
+#include "Framework/Objects.h"
+#include "Framework/Rendering.h"
+
+namespace
+{
+    /**
+     * @brief UpdateBenchmarkScene이 차례로 측정할 메인 스레드를 포함한 스레드 수들.
+     */
+    constexpr std::array<std::size_t, 4> BenchmarkThreadCounts = { 1, 2, 4, 8 };
+
+    /**
+     * @brief 스레드 수를 바꾼 뒤 측정하지 않고 건너뛸 프레임 수.
+     */
+    constexpr std::size_t WarmupFrameCount = 30;
+
+    /**
+     * @brief 스레드 수마다 측정할 프레임 수.
+     */
+    constexpr std::size_t MeasuredFrameCount = 120;
+
+    /**
+     * @brief 조회 대상으로만 쓰이는 빈 컴포넌트. 생명주기 함수를 재정의하지 않으므로 씬의 호출 목록에 등록되지 않습니다.
+     */
+    template <int Index>
+    class EmptyComponent : public Component
+    {
+    public:
+        explicit EmptyComponent(Object* const owner_) noexcept
+            : Component(owner_)
+        {
+        }
+    };
+
+    /**
+     * @brief 스프링으로 이어진 점들을 매 프레임 시뮬레이션하고, 그 중심으로 자신의 트랜스폼을 옮기는 컴포넌트.
+     *        자신의 상태와 트랜스폼만 다루므로 작업 스레드에서 갱신해도 안전합니다.
+     */
+    class SpringChainComponent : public Component
+    {
+    public:
+        static constexpr bool IsParallelSafe = true;
+
+        explicit SpringChainComponent(Object* const owner_) noexcept
+            : Component(owner_)
+        {
+            for (std::size_t index = 0; index < PointCount; ++index)
+            {
+                positions[index]  = glm::fvec3(static_cast<float>(index), 0.0f, 0.0f);
+                velocities[index] = glm::fvec3(0.0f);
+            }
+        }
+
+        virtual void Update() override
+        {
+            const float stepTime = 1.0f / (60.0f * static_cast<float>(StepCount));
+
+            for (std::size_t step = 0; step < StepCount; ++step)
+            {
+                // 첫 번째 점은 원을 따라 움직이고, 나머지 점들은 앞의 점에 스프링으로 끌려갑니다.
+                phase        += stepTime;
+                positions[0]  = glm::fvec3(std::cos(phase), std::sin(phase), 0.0f);
+
+                for (std::size_t index = 1; index < PointCount; ++index)
+                {
+                    const glm::fvec3 offset = positions[index - 1] - positions[index];
+                    const float      length = std::max(glm::length(offset), 1e-6f);
+                    const glm::fvec3 force  = offset * (Stiffness * (length - RestLength) / length) - velocities[index] * Damping;
+
+                    velocities[index] += force * stepTime;
+                    positions[index]  += velocities[index] * stepTime;
+                }
+            }
+
+            glm::fvec3 center(0.0f);
+            for (const glm::fvec3& position : positions)
+            {
+                center += position;
+            }
+
+            GetTransform()->SetPosition(center / static_cast<float>(PointCount));
+        }
+
+    private:
+        static constexpr std::size_t PointCount = 16;
+        static constexpr std::size_t StepCount  = 8;
+        static constexpr float       Stiffness  = 40.0f;
+        static constexpr float       Damping    = 0.5f;
+        static constexpr float       RestLength = 1.0f;
+
+        std::array<glm::fvec3, PointCount> positions;
+        std::array<glm::fvec3, PointCount> velocities;
+        float                              phase = 0.0f;
+    };
+
+    /**
+     * @brief 타입 ID 도입 전의 GetComponent와 같이, 추가된 순서대로 컴포넌트의 동적 타입을 비교합니다.
+     */
+    template <FromComponent TComponent>
+    TComponent* FindByTypeScan(const std::vector<Component*>& components_) noexcept
+    {
+        const std::type_index targetType = std::type_index(typeid(TComponent));
+
+        for (Component* const component : components_)
+        {
+            if (std::type_index(typeid(*component)) == targetType)
+            {
+                return static_cast<TComponent*>(component);
+            }
+        }
+
+        return nullptr;
+    }
+
+    /**
+     * @brief 두 방식으로 모든 오브젝트에서 같은 타입을 여러 번 조회하여 조회 한 번의 평균 시간을 로그로 남깁니다.
+     *
+     * @details 조회 결과를 누적하여 최적화로 조회가 사라지지 않게 하고, 두 방식의 결과가 같은지 확인합니다.
+     */
+    template <FromComponent TComponent>
+    void MeasureLookup(const std::vector<Object*>&                objects_,
+                       const std::vector<std::vector<Component*>>& componentLists_,
+                       const std::size_t                          roundCount_,
+                       const std::string_view                     label_) noexcept
+    {
+        using Clock = std::chrono::steady_clock;
+
+        const double lookupCount = static_cast<double>(objects_.size() * roundCount_);
+
+        std::uintptr_t slotChecksum = 0;
+        const auto     slotStart    = Clock::now();
+        for (std::size_t round = 0; round < roundCount_; ++round)
+        {
+            for (const Object* const object : objects_)
+            {
+                slotChecksum += reinterpret_cast<std::uintptr_t>(object->GetComponent<TComponent>());
+            }
+        }
+        const double slotTime = std::chrono::duration<double, std::nano>(Clock::now() - slotStart).count() / lookupCount;
+
+        std::uintptr_t scanChecksum = 0;
+        const auto     scanStart    = Clock::now();
+        for (std::size_t round = 0; round < roundCount_; ++round)
+        {
+            for (const std::vector<Component*>& components : componentLists_)
+            {
+                scanChecksum += reinterpret_cast<std::uintptr_t>(FindByTypeScan<TComponent>(components));
+            }
+        }
+        const double scanTime = std::chrono::duration<double, std::nano>(Clock::now() - scanStart).count() / lookupCount;
+
+        if (slotChecksum != scanChecksum)
+        {
+            Logger::Error("Component lookup benchmark ({}): the two lookups returned different components.", label_);
+        }
+
+        Logger::Info("Component lookup ({}): type ID slot {:.2f} ns, typeid scan {:.2f} ns ({:.1f}x)",
+                     label_,
+                     slotTime,
+                     scanTime,
+                     slotTime > 0.0 ? scanTime / slotTime : 0.0);
+    }
+}
+
+void LookupBenchmarkScene::OnEnter() noexcept
+{
+    constexpr std::size_t ObjectCount = 4096;
+    constexpr std::size_t RoundCount  = 256;
+
+    AddGameObject("Main Camera", "Camera")->AddComponent<Camera>();
+
+    // 오브젝트마다 Transform 뒤에 빈 컴포넌트 여섯 개를 붙이고, 이전 구현이 탐색하던 순서의 목록을 따로 보관합니다.
+    std::vector<Object*>                objects;
+    std::vector<std::vector<Component*>> componentLists;
+    objects.reserve(ObjectCount);
+    componentLists.reserve(ObjectCount);
+
+    for (std::size_t index = 0; index < ObjectCount; ++index)
+    {
+        Object* const object = AddGameObject("Lookup Target", "Benchmark");
+
+        componentLists.push_back({ object->GetTransform(),
+                                   object->AddComponent<EmptyComponent<0>>(),
+                                   object->AddComponent<EmptyComponent<1>>(),
+                                   object->AddComponent<EmptyComponent<2>>(),
+                                   object->AddComponent<EmptyComponent<3>>(),
+                                   object->AddComponent<EmptyComponent<4>>(),
+                                   object->AddComponent<EmptyComponent<5>>() });
+        objects.push_back(object);
+    }
+
+    MeasureLookup<Transform>(objects, componentLists, RoundCount, "first of 7");
+    MeasureLookup<EmptyComponent<2>>(objects, componentLists, RoundCount, "4th of 7");
+    MeasureLookup<EmptyComponent<5>>(objects, componentLists, RoundCount, "last of 7");
+    MeasureLookup<Camera>(objects, componentLists, RoundCount, "missing");
+}
+
+void UpdateBenchmarkScene::OnEnter() noexcept
+{
+    constexpr std::size_t ObjectCount = 8192;
+
+    AddGameObject("Main Camera", "Camera")->AddComponent<Camera>();
+
+    for (std::size_t index = 0; index < ObjectCount; ++index)
+    {
+        AddGameObject("Spring Chain", "Benchmark")->AddComponent<SpringChainComponent>();
+    }
+
+    originalThreadCount = JobSystem::GetThreadCount();
+    phase               = 0;
+    phaseFrame          = 0;
+    phaseTime           = 0.0;
+    updateTimes.clear();
+
+    JobSystem::Initialize(BenchmarkThreadCounts[phase]);
+
+    Logger::Info("Update benchmark: {} parallel-safe objects, {} warm-up and {} measured frames per thread count.",
+                 ObjectCount,
+                 WarmupFrameCount,
+                 MeasuredFrameCount);
+}
+
+void UpdateBenchmarkScene::OnUpdate() noexcept
+{
+    if (phase >= BenchmarkThreadCounts.size())
+    {
+        return;
+    }
+
+    // 스레드를 새로 만든 직후의 프레임들은 캐시와 스레드 기동 비용이 섞이므로 건너뜁니다.
+    if (++phaseFrame > WarmupFrameCount)
+    {
+        phaseTime += GetParallelUpdateTime();
+    }
+
+    if (phaseFrame < WarmupFrameCount + MeasuredFrameCount)
+    {
+        return;
+    }
+
+    updateTimes.push_back(phaseTime / static_cast<double>(MeasuredFrameCount));
+    Logger::Info("Update benchmark: {} threads, {:.3f} ms per update.", BenchmarkThreadCounts[phase], updateTimes.back());
+
+    phaseFrame = 0;
+    phaseTime  = 0.0;
+    if (++phase < BenchmarkThreadCounts.size())
+    {
+        JobSystem::Initialize(BenchmarkThreadCounts[phase]);
+    }
+}
+
+void UpdateBenchmarkScene::OnExit() noexcept
+{
+    LogResults();
+
+    JobSystem::Initialize(originalThreadCount);
+}
+
+void UpdateBenchmarkScene::LogResults() const noexcept
+{
+    if (updateTimes.empty())
+    {
+        Logger::Warn("Update benchmark: no thread count finished measuring. Run at least {} frames.",
+                     BenchmarkThreadCounts.size() * (WarmupFrameCount + MeasuredFrameCount));
+        return;
+    }
+
+    for (std::size_t index = 0; index < updateTimes.size(); ++index)
+    {
+        Logger::Info("Update benchmark: {} threads, {:.3f} ms per update, {:.2f}x speedup over 1 thread.",
+                     BenchmarkThreadCounts[index],
+                     updateTimes[index],
+                     updateTimes[index] > 0.0 ? updateTimes[0] / updateTimes[index] : 0.0);
+    }
+}
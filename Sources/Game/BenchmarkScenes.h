@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Framework/Scenes.h"
+
+/**
+ * @class LookupBenchmarkScene
+ *
+ * @brief 타입 ID 슬롯을 사용하는 Object::GetComponent와 이전의 typeid 선형 탐색을 같은 컴포넌트들에 대해 비교하는 디버그 씬입니다.
+ *
+ * @details 입장할 때 한 번 측정하고 결과를 로그로 남깁니다. 시작 씬은 첫 프레임에 바로 들어가므로
+ *          --headless --frames 1 --scene "Lookup Benchmark Scene"으로 실행하면 "Component lookup (...)" 네 줄이 출력됩니다.
+ */
+class LookupBenchmarkScene : public Scene
+{
+protected:
+    virtual void OnEnter() noexcept override;
+};
+
+/**
+ * @class UpdateBenchmarkScene
+ *
+ * @brief 병렬 갱신이 가능한 컴포넌트를 가진 루트 오브젝트를 많이 만들어 작업 스레드 수에 따른 Update 확장성을 측정하는 디버그 씬입니다.
+ *
+ * @details 작업 시스템을 1, 2, 4, 8개의 스레드로 차례로 다시 초기화하며, 각각 준비 프레임을 건너뛴 뒤 병렬 갱신 단계의 시간만 잽니다.
+ *          각 스레드 수의 측정이 끝날 때와 씬을 나갈 때 갱신 한 번의 평균 시간과 1개 스레드 대비 속도 향상을 로그로 남깁니다.
+ *          --headless --frames 600 --scene "Update Benchmark Scene"으로 실행합니다.
+ */
+class UpdateBenchmarkScene : public Scene
+{
+protected:
+    virtual void OnEnter() noexcept override;
+
+    virtual void OnUpdate() noexcept override;
+
+    virtual void OnExit() noexcept override;
+
+private:
+    /**
+     * @brief 측정 결과를 로그로 남깁니다.
+     */
+    void LogResults() const noexcept;
+
+    /**
+     * @brief 씬에 들어올 때의 작업 시스템 스레드 수. 나갈 때 되돌립니다.
+     */
+    std::size_t originalThreadCount = 0;
+
+    /**
+     * @brief 지금 측정 중인 스레드 수의 인덱스.
+     */
+    std::size_t phase = 0;
+
+    /**
+     * @brief 지금 스레드 수로 지난 프레임 수.
+     */
+    std::size_t phaseFrame = 0;
+
+    /**
+     * @brief 지금 스레드 수로 측정한 병렬 갱신 시간의 합. (밀리초)
+     */
+    double phaseTime = 0.0;
+
+    /**
+     * @brief 스레드 수별 병렬 갱신 한 번의 평균 시간. (밀리초)
+     */
+    std::vector<double> updateTimes;
+};
@@ -9,7 +9,6 @@
 void CreditsScene::OnEnter() noexcept
 {
     Camera* const camera = AddGameObject("Main Camera", "Camera")->AddComponent<Camera>();
-    camera->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
 
 	ImageRenderer* backgroundSR = AddUIObject("Background", "Background")->AddComponent<ImageRenderer>();
 
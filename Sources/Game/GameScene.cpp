@@ -15,6 +15,7 @@ GameScene::~GameScene() noexcept
 void GameScene::InitializeVariables()
 {
     wallOBBs.clear();
+    wallVersions.clear();
 
     isGoalReached  = false;
     isGameCleared  = false;
@@ -24,10 +25,12 @@ void GameScene::InitializeVariables()
     rotatedAmountZ = 0.0f;
     checkHitWall   = 0.0f;
 
-    if (goalImage)
+    // 이전 씬의 오브젝트들은 Exit에서 이미 해제되었으므로, 핸들이 남아 있을 때만 파괴합니다.
+    if (ImageRenderer* const image = goalImage.Get())
     {
-        goalImage->Destroy();
+        image->Destroy();
     }
+    goalImage.Reset();
 }
 
 void GameScene::SetupCameraAndLight()
@@ -36,8 +39,8 @@ void GameScene::SetupCameraAndLight()
     cameraObj->GetTransform()->SetPosition(glm::vec3(0.0f, 20.0f, 5.0f));
     cameraObj->GetTransform()->LookAt(glm::vec3(0.0f, 0.0f, 0.0f));
 
-    mainCamera = cameraObj->AddComponent<Camera>();
-    mainCamera->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
+    Camera* const camera = cameraObj->AddComponent<Camera>();
+    mainCamera = camera;
 
     Object* lightObj = AddGameObject("Directional Light", "Light");
     lightObj->GetTransform()->SetPosition(glm::vec3(0.0f, 3.0f, 0.0f));
@@ -47,7 +50,6 @@ void GameScene::SetupCameraAndLight()
     if (mainLight)
     {
         mainLight->SetColor(glm::vec3(1.0f));
-        mainLight->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
     }
 }
 
@@ -142,6 +144,30 @@ void GameScene::SetupFont()
     }
 }
 
+void GameScene::LoadBoardTextures()
+{
+    // 다시 시작할 때는 이미 만든 텍스처 배열을 그대로 사용합니다.
+    const std::string path = "Baked/BoardTextures";
+    boardTextures          = ResourceManager::GetResource<TextureArray>(path);
+    if (boardTextures)
+        return;
+
+    // 레이어는 BoardLayer의 순서와 같아야 합니다.
+    TextureArrayBuilder builder(256, 256);
+    builder.Add("Assets\\Textures\\wood_texture1.png");
+    builder.Add("Assets\\Textures\\wood_texture2.png");
+    builder.Add("Assets\\Textures\\wood_texture3.png");
+    builder.Add("Assets\\Textures\\wood_texture4.png");
+    builder.Add("Assets\\Textures\\mapBase.png");
+    builder.Add("Assets\\Textures\\wall.png");
+    builder.Add("Assets\\Textures\\handle.png");
+    builder.Add("Assets\\Textures\\handle_bar.png");
+    builder.Add("Assets\\Textures\\Red.png");
+    builder.Add("Assets\\Textures\\Green.png");
+
+    boardTextures = ResourceManager::AddResource<TextureArray>(path, builder.Build());
+}
+
 void GameScene::CreateLabyrinthBoard()
 {
     // 피봇 생성
@@ -154,28 +180,28 @@ void GameScene::CreateLabyrinthBoard()
     zHandlePivot->GetTransform()->SetPosition(glm::vec3(0.0f, -3.0f, 10.5f));
 
     // X축 핸들
-    CreateCube(xHandlePivot, meshCube, texHandle, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 2.0f, 2.0f), false);
-    CreateCube(nullptr, meshCube, texBar, glm::vec3(0.7f, -3.0f, 0.0f), glm::vec3(18.8f, 0.4f, 0.4f), false);
-    CreateCube(nullptr, meshCube, texBar, glm::vec3(8.5f, -1.5f, 0.0f), glm::vec3(0.4f, 3.0f, 0.4f), false);
-    CreateCube(nullptr, meshCube, texBar, glm::vec3(-8.5f, -1.5f, 0.0f), glm::vec3(0.4f, 3.0f, 0.4f), false);
+    CreateCube(xHandlePivot, meshCube, LayerHandle, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(1.0f, 2.0f, 2.0f), false);
+    CreateCube(nullptr, meshCube, LayerBar, glm::vec3(0.7f, -3.0f, 0.0f), glm::vec3(18.8f, 0.4f, 0.4f), false);
+    CreateCube(nullptr, meshCube, LayerBar, glm::vec3(8.5f, -1.5f, 0.0f), glm::vec3(0.4f, 3.0f, 0.4f), false);
+    CreateCube(nullptr, meshCube, LayerBar, glm::vec3(-8.5f, -1.5f, 0.0f), glm::vec3(0.4f, 3.0f, 0.4f), false);
 
     // X축 프레임
-    CreateCube(xFramePivot, meshCube, texWood2, glm::vec3(8.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 17.5f), false);
-    CreateCube(xFramePivot, meshCube, texWood2, glm::vec3(-8.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 17.5f), false);
-    CreateCube(xFramePivot, meshCube, texWood2, glm::vec3(0.0f, 0.0f, 8.5f), glm::vec3(17.5f, 2.0f, 0.4f), false);
-    CreateCube(xFramePivot, meshCube, texWood2, glm::vec3(0.0f, 0.0f, -8.5f), glm::vec3(17.5f, 2.0f, 0.4f), false);
+    CreateCube(xFramePivot, meshCube, LayerWood2, glm::vec3(8.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 17.5f), false);
+    CreateCube(xFramePivot, meshCube, LayerWood2, glm::vec3(-8.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 17.5f), false);
+    CreateCube(xFramePivot, meshCube, LayerWood2, glm::vec3(0.0f, 0.0f, 8.5f), glm::vec3(17.5f, 2.0f, 0.4f), false);
+    CreateCube(xFramePivot, meshCube, LayerWood2, glm::vec3(0.0f, 0.0f, -8.5f), glm::vec3(17.5f, 2.0f, 0.4f), false);
 
     // Z축 핸들
-    CreateCube(zHandlePivot, meshCube, texHandle, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(2.0f, 2.0f, 1.0f), false);
-    CreateCube(nullptr, meshCube, texBar, glm::vec3(0.0f, -3.0f, 0.7f), glm::vec3(0.4f, 0.4f, 19.4f), false);
-    CreateCube(nullptr, meshCube, texBar, glm::vec3(0.0f, -1.5f, 9.5f), glm::vec3(0.4f, 3.0f, 0.4f), false);
-    CreateCube(nullptr, meshCube, texBar, glm::vec3(0.0f, -1.5f, -9.5f), glm::vec3(0.4f, 3.0f, 0.4f), false);
+    CreateCube(zHandlePivot, meshCube, LayerHandle, glm::vec3(0.0f, 0.0f, 0.0f), glm::vec3(2.0f, 2.0f, 1.0f), false);
+    CreateCube(nullptr, meshCube, LayerBar, glm::vec3(0.0f, -3.0f, 0.7f), glm::vec3(0.4f, 0.4f, 19.4f), false);
+    CreateCube(nullptr, meshCube, LayerBar, glm::vec3(0.0f, -1.5f, 9.5f), glm::vec3(0.4f, 3.0f, 0.4f), false);
+    CreateCube(nullptr, meshCube, LayerBar, glm::vec3(0.0f, -1.5f, -9.5f), glm::vec3(0.4f, 3.0f, 0.4f), false);
 
     // Z축 프레임
-    CreateCube(zFramePivot, meshCube, texWood1, glm::vec3(9.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 19.5f), false);
-    CreateCube(zFramePivot, meshCube, texWood1, glm::vec3(-9.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 19.5f), false);
-    CreateCube(zFramePivot, meshCube, texWood1, glm::vec3(0.0f, 0.0f, 9.5f), glm::vec3(19.5f, 2.0f, 0.4f), false);
-    CreateCube(zFramePivot, meshCube, texWood1, glm::vec3(0.0f, 0.0f, -9.5f), glm::vec3(19.5f, 2.0f, 0.4f), false);
+    CreateCube(zFramePivot, meshCube, LayerWood1, glm::vec3(9.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 19.5f), false);
+    CreateCube(zFramePivot, meshCube, LayerWood1, glm::vec3(-9.5f, 0.0f, 0.0f), glm::vec3(0.4f, 2.0f, 19.5f), false);
+    CreateCube(zFramePivot, meshCube, LayerWood1, glm::vec3(0.0f, 0.0f, 9.5f), glm::vec3(19.5f, 2.0f, 0.4f), false);
+    CreateCube(zFramePivot, meshCube, LayerWood1, glm::vec3(0.0f, 0.0f, -9.5f), glm::vec3(19.5f, 2.0f, 0.4f), false);
 
     for (int i{}; i < wallOBBs.size(); ++i)
     {
@@ -183,8 +209,8 @@ void GameScene::CreateLabyrinthBoard()
         wallOBBs[i]->GetOwner()->GetTransform()->SetScale(glm::vec3(org.x, 0.0f, org.z));
     }
 
-    CreateCube(boardPivot, meshCube, texWood5, glm::vec3(0.0f, -1.5f, 0.0f), glm::vec3(15.0f, 1.0f, 15.0f), false);
-    CreateCube(nullptr, meshCube, texWood4, glm::vec3(0.0f, -5.0f, 0.0f), glm::vec3(20.0f, 1.0f, 20.0f), false);
+    CreateCube(boardPivot, meshCube, LayerMapBase, glm::vec3(0.0f, -1.5f, 0.0f), glm::vec3(15.0f, 1.0f, 15.0f), false);
+    CreateCube(nullptr, meshCube, LayerWood4, glm::vec3(0.0f, -5.0f, 0.0f), glm::vec3(20.0f, 1.0f, 20.0f), false);
 }
 
 void GameScene::CreateLabyrinthLevel(int levelNum)
@@ -204,45 +230,138 @@ void GameScene::CreateLabyrinthLevel(int levelNum)
     float            offsetX = width / 2.0f;
     float            offsetZ = height / 2.0f;
 
+    // 타일 종류를 범위 밖은 0으로 취급하여 조회합니다.
+    auto tileAt = [&](int x, int z) {
+        if (x < 0 || x >= width || z < 0 || z >= height)
+            return 0;
+        return tiles[z * width + x];
+    };
+
+    // 시작/골인 지점은 바닥보다 크게 덮으므로, 바닥 층에서는 모두 꽉 찬 타일로 취급합니다.
+    auto isFloorSolid = [&](int x, int z) { return tileAt(x, z) != 0; };
+    auto isWallSolid  = [&](int x, int z) { return tileAt(x, z) == 2; };
+
+    // 옆 타일이 꽉 차 있어 보이지 않는 옆면을 제외한 면 플래그를 구합니다.
+    auto visibleSides = [](auto isSolid, int x, int z) {
+        std::uint8_t faces = MeshBuilder::AllFaces;
+        if (isSolid(x + 1, z))
+            faces &= ~MeshBuilder::PositiveX;
+        if (isSolid(x - 1, z))
+            faces &= ~MeshBuilder::NegativeX;
+        if (isSolid(x, z + 1))
+            faces &= ~MeshBuilder::PositiveZ;
+        if (isSolid(x, z - 1))
+            faces &= ~MeshBuilder::NegativeZ;
+        return faces;
+    };
+
+    // 텍스처별로 하나의 메쉬로 굽습니다.
+    MeshBuilder floorBuilder;
+    MeshBuilder wallBuilder;
+    MeshBuilder startBuilder;
+    MeshBuilder goalBuilder;
+
     for (int z = 0; z < height; ++z)
     {
         for (int x = 0; x < width; ++x)
         {
-            int type = tiles[z * width + x];
+            int type = tileAt(x, z);
             if (type == 0)
                 continue;
 
             float posX = (float)x - offsetX + 0.5f;
             float posZ = (float)z - offsetZ + 0.5f;
 
-            // 바닥 생성
-            CreateCube(boardPivot, meshCube, texWood3, glm::vec3(posX, -0.5f, posZ), glm::vec3(1.0f), true);
+            const glm::vec3 floorPosition(posX, -0.5f, posZ);
+            const glm::vec3 wallPosition(posX, 0.5f, posZ);
+            const glm::vec3 markerScale(1.0f, 1.2f, 1.0f);
+
+            // 바닥 충돌은 타일 단위로 유지합니다.
+            CreateTileCollider(floorPosition, glm::vec3(1.0f));
+
+            // 시작/골인 지점의 바닥은 지점 블록에 완전히 덮이므로 굽지 않습니다.
+            if (type == 1 || type == 2)
+            {
+                std::uint8_t faces = visibleSides(isFloorSolid, x, z);
+                if (type == 2)
+                    faces &= ~MeshBuilder::PositiveY;
+
+                floorBuilder.Append(*meshCube, glm::translate(glm::mat4(1.0f), floorPosition), faces);
+            }
 
             // 벽 생성
             if (type == 2)
             {
-                CreateCube(boardPivot, meshCube, texWall, glm::vec3(posX, 0.5f, posZ), glm::vec3(1.0f), true);
+                CreateTileCollider(wallPosition, glm::vec3(1.0f));
+
+                const std::uint8_t faces = visibleSides(isWallSolid, x, z) & ~MeshBuilder::NegativeY;
+                wallBuilder.Append(*meshCube, glm::translate(glm::mat4(1.0f), wallPosition), faces);
             }
             // 시작 지점
             else if (type == 3)
             {
                 startPosition = glm::vec3(posX, 2.0f, posZ);
-                CreateCube(
-                        boardPivot, meshCube, texRed, glm::vec3(posX, -0.5f, posZ), glm::vec3(1.0f, 1.2f, 1.0f), false);
+                startBuilder.Append(*meshCube, glm::scale(glm::translate(glm::mat4(1.0f), floorPosition), markerScale));
             }
             // 골인 지점
             else if (type == 4)
             {
                 goalPosition = glm::vec3(posX, 0.0f, posZ);
-                CreateCube(boardPivot,
-                           meshCube,
-                           texGreen,
-                           glm::vec3(posX, -0.5f, posZ),
-                           glm::vec3(1.0f, 1.2f, 1.0f),
-                           false);
+                goalBuilder.Append(*meshCube, glm::scale(glm::translate(glm::mat4(1.0f), floorPosition), markerScale));
             }
         }
     }
+
+    // 구운 메쉬들은 보드 피봇의 자식 하나 아래에서 보드와 함께 움직입니다.
+    Object* const levelObject = AddGameObject("LabyrinthLevel", "Deco");
+    levelObject->GetTransform()->SetParent(boardPivot->GetTransform());
+
+    const std::string bakedPath = "Baked/level" + std::to_string(levelNum) + "/";
+    CreateBakedMesh(levelObject, floorBuilder, LayerWood3, bakedPath + "floor");
+    CreateBakedMesh(levelObject, wallBuilder, LayerWall, bakedPath + "wall");
+    CreateBakedMesh(levelObject, startBuilder, LayerRed, bakedPath + "start");
+    CreateBakedMesh(levelObject, goalBuilder, LayerGreen, bakedPath + "goal");
+}
+
+void GameScene::CreateBakedMesh(Object* parent, MeshBuilder& builder, std::uint32_t layer, const std::string& path)
+{
+    const std::size_t triangleCount = builder.GetTriangleCount();
+
+    // 같은 레벨을 다시 시작할 때는 이미 구운 메쉬를 그대로 사용합니다.
+    Mesh* mesh = ResourceManager::GetResource<Mesh>(path);
+    if (!mesh)
+    {
+        // 구운 메쉬는 정점이 많으므로 압축된 정점 형식을 사용합니다. 서로 맞닿는 메쉬 사이에 틈이 생기지 않도록 위치는 float로 둡니다.
+        mesh = ResourceManager::AddResource<Mesh>(path, builder.Build(Mesh::VertexFormat::Packed));
+        if (!mesh)
+            return;
+
+        SPDLOG_INFO("Baked {}: {} triangles", path, triangleCount);
+    }
+
+    Object* obj = AddGameObject("BakedMesh", "Deco");
+    obj->GetTransform()->SetParent(parent->GetTransform());
+
+    auto render = obj->AddComponent<MeshRenderer>();
+    render->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\StandardArray"));
+    render->SetMesh(mesh);
+    render->SetTexture(boardTextures);
+    render->SetTextureLayer(layer);
+}
+
+void GameScene::CreateTileCollider(glm::vec3 pos, glm::vec3 scale)
+{
+    // 렌더링은 구운 메쉬가 담당하므로 충돌용 트랜스폼과 OBB만 가집니다.
+    Object* obj = AddGameObject("TileCollider", "Wall");
+    obj->GetTransform()->SetParent(boardPivot->GetTransform());
+    obj->GetTransform()->SetPosition(pos);
+    obj->GetTransform()->SetScale(scale);
+
+    OBB* obb = obj->AddComponent<OBB>();
+    obb->resize(scale * 0.5f);
+    obb->teleport(pos);
+    wallOBBs.push_back(obb);
+    wallVersions.push_back(0);
 }
 
 void GameScene::CreatePlayer()
@@ -260,9 +379,10 @@ void GameScene::CreatePlayer()
     obb->resize(glm::vec3(0.35f)); // 반지름
     obb->teleport(startPosition);
 
-    playerController = playerObject->AddComponent<PlayerController>();
-    playerController->SetGravityScale(1.0f);
-    playerController->SetSlopeBoost(2.5f);
+    PlayerController* const controller = playerObject->AddComponent<PlayerController>();
+    controller->SetGravityScale(1.0f);
+    controller->SetSlopeBoost(2.5f);
+    playerController = controller;
 }
 
 void GameScene::HandleInput()
@@ -319,7 +439,8 @@ void GameScene::ChangeFontValue()
 
 void GameScene::UpdateGameLogic()
 {
-    if (!playerController || !boardPivot)
+    PlayerController* const controller = playerController.Get();
+    if (!controller || !boardPivot)
         return;
 
     // 물리 벽 위치 동기화
@@ -327,19 +448,22 @@ void GameScene::UpdateGameLogic()
 
     // 바닥 기울기 전달
     glm::vec3 normal = boardPivot->GetTransform()->GetUp();
-    playerController->SetGroundNormal(normal);
+    controller->SetGroundNormal(normal);
 
     // 충돌 체크
-    for (OBB* wall : wallOBBs)
+    for (const Handle<OBB>& wall : wallOBBs)
     {
-        playerController->CheckCollision(wall);
+        if (OBB* const obb = wall.Get())
+        {
+            controller->CheckCollision(obb);
+        }
     }
 
     // 낙하 체크
     if (playerObject->GetTransform()->GetPosition().y < -10.0f)
     {
         playerObject->GetTransform()->SetPosition(startPosition);
-        playerController->setDir(glm::vec3(0));
+        controller->setDir(glm::vec3(0));
         GameManager::curScoreData.deathCount++;
         resurrection->Play();
     }
@@ -356,12 +480,15 @@ void GameScene::UpdateGameLogic()
 
         Object* goalObj = AddUIObject("Goal Image", "UI");
         goalObj->GetTransform()->SetScale(glm::vec3(600.0f, 300.0f, 1.0f));
-        goalImage = goalObj->AddComponent<ImageRenderer>();
-        goalImage->GetTransform()->SetPosition(
-                glm::vec3(Application::GetWindowWidth() * 0.5f, Application::GetWindowHeight() * 0.5f, 0.0f));
-        goalImage->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\UIObject"));
-        goalImage->SetMesh(ResourceManager::LoadResource<Mesh>("Assets\\Meshes\\Rect.obj"));
-        goalImage->SetTexture(ResourceManager::LoadResource<Texture>("Assets\\Textures\\Congratulations.png"));
+        ImageRenderer* const image = goalObj->AddComponent<ImageRenderer>();
+        goalImage                  = image;
+
+        // 다른 UI보다 앞에 그려지도록 z를 높여 둡니다.
+        image->GetTransform()->SetPosition(
+                glm::vec3(Application::GetWindowWidth() * 0.5f, Application::GetWindowHeight() * 0.5f, 0.5f));
+        image->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\UIObject"));
+        image->SetMesh(ResourceManager::LoadResource<Mesh>("Assets\\Meshes\\Rect.obj"));
+        image->SetTexture(ResourceManager::LoadResource<Texture>("Assets\\Textures\\Congratulations.png"));
     }
     else
     {
@@ -408,13 +535,27 @@ void GameScene::UpdateGameLogic()
 
 void GameScene::UpdatePhysicsWalls()
 {
-    for (OBB* obb : wallOBBs)
+    for (std::size_t i = 0; i < wallOBBs.size(); ++i)
     {
+        OBB* const obb = wallOBBs[i].Get();
+        if (!obb)
+        {
+            continue;
+        }
+
         Transform* tr = obb->GetTransform();
         if (tr)
         {
+            // 보드가 움직이지 않아 월드 행렬이 그대로라면 동기화를 건너뜁니다.
+            const std::uint32_t version = tr->GetVersion();
+            if (wallVersions[i] == version)
+            {
+                continue;
+            }
+            wallVersions[i] = version;
+
             // 1. 월드 행렬 가져오기
-            glm::mat4 worldMat = tr->GetWorldMatrix();
+            const glm::mat4 worldMat = tr->GetWorldMatrix();
 
             // 2. 위치 추출
             glm::vec3 pos = glm::vec3(worldMat[3]);
@@ -437,7 +578,7 @@ void GameScene::UpdatePhysicsWalls()
     }
 }
 
-void GameScene::CreateCube(Object* parent, Mesh* mesh, Texture* texture, glm::vec3 pos, glm::vec3 scale, bool isWall)
+void GameScene::CreateCube(Object* parent, Mesh* mesh, std::uint32_t layer, glm::vec3 pos, glm::vec3 scale, bool isWall)
 {
     Object* obj = AddGameObject("Cube", isWall ? "Wall" : "Deco");
     if (parent)
@@ -446,9 +587,17 @@ void GameScene::CreateCube(Object* parent, Mesh* mesh, Texture* texture, glm::ve
     obj->GetTransform()->SetScale(scale);
 
     auto render = obj->AddComponent<MeshRenderer>();
-    render->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
+    render->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\StandardArray"));
     render->SetMesh(mesh);
-    render->SetTexture(texture);
+    render->SetTexture(boardTextures);
+    render->SetTextureLayer(layer);
+    render->SetInstancedShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\StandardArrayInstanced"));
+
+    // 부모가 없는 장식은 움직이지 않으므로 정적 오브젝트로 설정합니다.
+    if (!parent)
+    {
+        obj->SetStatic(true);
+    }
 
     if (isWall)
     {
@@ -456,5 +605,6 @@ void GameScene::CreateCube(Object* parent, Mesh* mesh, Texture* texture, glm::ve
         obb->resize(scale * 0.5f);
         obb->teleport(pos);
         wallOBBs.push_back(obb);
+        wallVersions.push_back(0);
     }
 }
\ No newline at end of file
@@ -34,6 +34,9 @@ class GameScene : public Scene
         // 카메라 및 라이트 설정
         SetupCameraAndLight();
 
+        // 보드 텍스처 배열 로드
+        LoadBoardTextures();
+
         // 미로 생성
         CreateLabyrinthBoard();
 
@@ -76,6 +79,7 @@ class GameScene : public Scene
     void SetupCameraAndLight();
     void SetupAudio();
     void SetupFont();
+    void LoadBoardTextures();
     void CreateLabyrinthBoard();
     void CreateLabyrinthLevel(int levelNum);
     void CreatePlayer();
@@ -87,10 +91,12 @@ class GameScene : public Scene
     void ChangeFontValue();
     void UpdateGameLogic();
     void UpdatePhysicsWalls();
-    void CreateCube(Object* parent, Mesh* mesh, Texture* texture, glm::vec3 pos, glm::vec3 scale, bool isWall);
+    void CreateCube(Object* parent, Mesh* mesh, std::uint32_t layer, glm::vec3 pos, glm::vec3 scale, bool isWall);
+    void CreateBakedMesh(Object* parent, MeshBuilder& builder, std::uint32_t layer, const std::string& path);
+    void CreateTileCollider(glm::vec3 pos, glm::vec3 scale);
 
 private:
-    Camera*           mainCamera       = nullptr;
+    Handle<Camera>    mainCamera;
     Light*            mainLight        = nullptr;
 
     Object*           boardPivot       = nullptr;
@@ -99,14 +105,15 @@ class GameScene : public Scene
     Object*           xHandlePivot     = nullptr;
     Object*           zHandlePivot     = nullptr;
     Object*           playerObject     = nullptr;
-    PlayerController* playerController = nullptr;
+    Handle<PlayerController> playerController;
 
-    std::vector<OBB*> wallOBBs;
+    std::vector<Handle<OBB>>   wallOBBs;
+    std::vector<std::uint32_t> wallVersions;
 
 
     glm::vec3 startPosition;
     glm::vec3 goalPosition;
-    ImageRenderer* goalImage = nullptr;
+    Handle<ImageRenderer> goalImage;
     bool      isGoalReached;
     bool      isGameCleared;
     float     goalDelayTimer; // 골인 시 효과음 들릴 시간을 좀 주기 위한 용도
@@ -123,17 +130,23 @@ class GameScene : public Scene
     Mesh* meshSphere = ResourceManager::LoadResource<Mesh>("Assets\\Meshes\\Ball.obj");
     Mesh* meshCube   = ResourceManager::LoadResource<Mesh>("Assets\\Meshes\\Cube.obj");
 
-    Texture* texBall   = ResourceManager::LoadResource<Texture>("Assets\\Textures\\Poketball.png");
-    Texture* texWood1  = ResourceManager::LoadResource<Texture>("Assets\\Textures\\wood_texture1.png");
-    Texture* texWood2  = ResourceManager::LoadResource<Texture>("Assets\\Textures\\wood_texture2.png");
-    Texture* texWood3  = ResourceManager::LoadResource<Texture>("Assets\\Textures\\wood_texture3.png");
-    Texture* texWood4  = ResourceManager::LoadResource<Texture>("Assets\\Textures\\wood_texture4.png");
-    Texture* texWood5  = ResourceManager::LoadResource<Texture>("Assets\\Textures\\mapBase.png");
-    Texture* texWall   = ResourceManager::LoadResource<Texture>("Assets\\Textures\\wall.png");
-    Texture* texHandle = ResourceManager::LoadResource<Texture>("Assets\\Textures\\handle.png");
-    Texture* texBar    = ResourceManager::LoadResource<Texture>("Assets\\Textures\\handle_bar.png");
-    Texture* texRed    = ResourceManager::LoadResource<Texture>("Assets\\Textures\\Red.png");
-    Texture* texGreen  = ResourceManager::LoadResource<Texture>("Assets\\Textures\\Green.png");
+    // 보드 텍스처 배열의 레이어. LoadBoardTextures에서 이 순서대로 추가합니다.
+    enum BoardLayer : std::uint32_t
+    {
+        LayerWood1,
+        LayerWood2,
+        LayerWood3,
+        LayerWood4,
+        LayerMapBase,
+        LayerWall,
+        LayerHandle,
+        LayerBar,
+        LayerRed,
+        LayerGreen,
+    };
+
+    Texture*      texBall       = ResourceManager::LoadResource<Texture>("Assets\\Textures\\Poketball.png");
+    TextureArray* boardTextures = nullptr;
 
     TextRenderer* deathCountView;
     TextRenderer* timerView;
@@ -1,11 +1,13 @@
 #include "../Framework/Application.h"
 #include "../Framework/Scenes.h"
 
+#include "GameManager.h"
 #include "TitleScene.h"
 #include "GameScene.h"
 #include "CreditsScene.h"
+#include "BenchmarkScenes.h"
 
-int main(int, char**)
+int main(int argc, char** argv)
 {
     Application::Specification spec;
     spec.name        = "Labyrinth Application";
@@ -14,6 +16,34 @@ int main(int, char**)
     spec.screenMode  = Application::ScreenMode::Windowed;
     spec.sholudVSync = true;
 
+    // 자동화된 성능 측정용 옵션: --headless --frames <개수> --scene <씬 이름> --level <레벨> --threads <스레드 수>
+    std::string startScene = "Title Scene";
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view argument = argv[i];
+        if (argument == "--headless")
+        {
+            spec.screenMode  = Application::ScreenMode::Headless;
+            spec.sholudVSync = false;
+        }
+        else if (argument == "--frames" && i + 1 < argc)
+        {
+            spec.frameLimit = std::atoi(argv[++i]);
+        }
+        else if (argument == "--scene" && i + 1 < argc)
+        {
+            startScene = argv[++i];
+        }
+        else if (argument == "--level" && i + 1 < argc)
+        {
+            GameManager::currentLevel = std::clamp(std::atoi(argv[++i]), 0, GameManager::maxLevel);
+        }
+        else if (argument == "--threads" && i + 1 < argc)
+        {
+            spec.threadCount = static_cast<std::size_t>(std::max(std::atoi(argv[++i]), 0));
+        }
+    }
+
     if (!Application::Initialize(spec))
     {
         return -1;
@@ -22,7 +52,9 @@ int main(int, char**)
     SceneManager::AddScene("Title Scene", std::make_unique<TitleScene>());
     SceneManager::AddScene("Game Scene", std::make_unique<GameScene>());
     SceneManager::AddScene("Credits Scene", std::make_unique<CreditsScene>());
-    SceneManager::LoadScene("Title Scene");
+    SceneManager::AddScene("Lookup Benchmark Scene", std::make_unique<LookupBenchmarkScene>());
+    SceneManager::AddScene("Update Benchmark Scene", std::make_unique<UpdateBenchmarkScene>());
+    SceneManager::LoadScene(startScene);
 
     return Application::Run();
 }
\ No newline at end of file
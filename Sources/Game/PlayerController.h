@@ -8,6 +8,9 @@
 class PlayerController : public Component
 {
 public:
+    // Update에서 자신의 트랜스폼과 OBB만 다루므로 작업 스레드에서 갱신해도 안전합니다.
+    static constexpr bool IsParallelSafe = true;
+
     explicit PlayerController(Object* const owner);
     virtual ~PlayerController() noexcept;
 
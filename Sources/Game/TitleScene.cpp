@@ -18,7 +18,6 @@ void TitleScene::OnEnter() noexcept
     // 카메라
     Object* const cameraObject = AddGameObject("Main Camera", "Camera");
     mainCamera                 = cameraObject->AddComponent<Camera>();
-    mainCamera->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
     cameraSpline               = cameraObject->AddComponent<Spline>();
 
     cameraSpline->AddPoint(glm::vec3(0.0f, 5.0f, 9.0f));
@@ -43,7 +42,6 @@ void TitleScene::OnEnter() noexcept
     lightObject->GetTransform()->SetPosition(glm::fvec3(0.0f, 0.0f, 0.0f));
     lightObject->GetTransform()->LookAt(glm::fvec3(0.0f, 0.0f, 0.0f));
     mainLight = lightObject->AddComponent<Light>();
-    mainLight->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
     mainLight->SetColor(glm::fvec3(0.0f, 0.0f, 0.0f));
 
     // 배경 미로
@@ -180,6 +178,13 @@ void TitleScene::CreateCube(Object* parent, Mesh* mesh, Texture* texture, glm::v
     renderer->SetShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\Standard"));
     renderer->SetMesh(mesh);
     renderer->SetTexture(texture);
+    renderer->SetInstancedShader(ResourceManager::LoadResource<Shader>("Assets\\Shaders\\StandardInstanced"));
+
+    // 부모가 없는 장식은 움직이지 않으므로 정적 오브젝트로 설정합니다.
+    if (!parent)
+    {
+        obj->SetStatic(true);
+    }
 
     // OBB 추가 안 함
 }